@@ -0,0 +1,53 @@
+#include "openxr/openxr_clock_mapper.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+namespace {
+xr::ClockMapper<> &calibratedMapper() {
+  static xr::ClockMapper<> mapper;
+  if (!mapper.calibrated()) {
+    const auto now = std::chrono::steady_clock::now();
+    mapper.addSample(now - std::chrono::seconds(1), xr::Time{1000000000});
+    mapper.addSample(now, xr::Time{2000000100});
+  }
+  return mapper;
+}
+} // namespace
+
+static void BM_ClockMapperToTime(benchmark::State &state) {
+  xr::ClockMapper<> &mapper = calibratedMapper();
+  auto clockTime = std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    clockTime += std::chrono::microseconds(1);
+    benchmark::DoNotOptimize(mapper.toTime(clockTime));
+  }
+}
+BENCHMARK(BM_ClockMapperToTime);
+
+static void BM_ClockMapperToTimePoint(benchmark::State &state) {
+  xr::ClockMapper<> &mapper = calibratedMapper();
+  xr::Time xrTime{2000000000};
+  for (auto _ : state) {
+    xrTime += xr::Duration{1000};
+    benchmark::DoNotOptimize(mapper.toTimePoint(xrTime));
+  }
+}
+BENCHMARK(BM_ClockMapperToTimePoint);
+
+// Under contention with a thread that keeps recalibrating.
+static void BM_ClockMapperToTimeWhileSampling(benchmark::State &state) {
+  xr::ClockMapper<> &mapper = calibratedMapper();
+  if (state.thread_index() == 0) {
+    int64_t offset = 0;
+    for (auto _ : state) {
+      mapper.addSample(std::chrono::steady_clock::now(), xr::Time{3000000000 + ++offset});
+    }
+  } else {
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(mapper.toTime(std::chrono::steady_clock::now()));
+    }
+  }
+}
+BENCHMARK(BM_ClockMapperToTimeWhileSampling)->Threads(2);
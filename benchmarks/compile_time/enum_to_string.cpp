@@ -0,0 +1,9 @@
+// Compiled but never run: benchmarks/CMakeLists.txt times compiling this file against openxr_enums.hpp as generated
+// (large sparse enums in a perfect hash table) and as generated with every enum in a switch.
+#include "openxr/openxr_enums.hpp"
+
+char const* structureTypeName(xr::StructureType value) { return xr::to_string_literal(value); }
+
+char const* resultName(xr::Result value) { return xr::to_string_literal(value); }
+
+char const* objectTypeName(xr::ObjectType value) { return xr::to_string_literal(value); }
@@ -0,0 +1,56 @@
+#!/usr/bin/python3
+#
+# Copyright (c) 2019 The Khronos Group Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Times a compiler command.
+
+Usage: time_compile.py [-runs N] LABEL -- COMMAND...
+
+Runs COMMAND N times and prints the fastest and the median wall-clock time, labelled with LABEL.
+"""
+
+import argparse
+import statistics
+import subprocess
+import sys
+import time
+
+
+def time_command(command, runs):
+    """Return the wall-clock times, in seconds, of running command the given number of times."""
+    times = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        subprocess.run(command, check=True)
+        times.append(time.perf_counter() - start)
+    return times
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('-runs', action='store', type=int, default=5,
+                        help='Number of times to run the command')
+    parser.add_argument('label', help='Name to print with the times')
+    parser.add_argument('command', nargs=argparse.REMAINDER,
+                        help='Compiler command to time, after --')
+    args = parser.parse_args()
+    command = args.command[1:] if args.command[:1] == ['--'] else args.command
+    if not command:
+        parser.error('no command to time')
+
+    times = time_command(command, args.runs)
+    print('{:<40} min {:.3f} s  median {:.3f} s  ({} runs)'.format(
+        args.label, min(times), statistics.median(times), args.runs))
+    sys.stdout.flush()
@@ -0,0 +1,88 @@
+#include "openxr/openxr.hpp"
+#include "openxr/openxr_enum_parse.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+// Names as they would appear in a configuration file, in both spellings.
+const std::vector<std::pair<std::string, xr::ReferenceSpaceType>> kReferenceSpaceTypes = {
+    {"View", xr::ReferenceSpaceType::View},
+    {"Local", xr::ReferenceSpaceType::Local},
+    {"Stage", xr::ReferenceSpaceType::Stage},
+    {"XR_REFERENCE_SPACE_TYPE_UNBOUNDED_MSFT", xr::ReferenceSpaceType::UnboundedMSFT},
+};
+
+const std::vector<std::pair<std::string, xr::StructureType>> kStructureTypes = {
+    {"FrameWaitInfo", xr::StructureType::FrameWaitInfo},
+    {"FrameState", xr::StructureType::FrameState},
+    {"CompositionLayerProjection", xr::StructureType::CompositionLayerProjection},
+    {"SpaceLocation", xr::StructureType::SpaceLocation},
+    {"ActionStatePose", xr::StructureType::ActionStatePose},
+    {"XR_TYPE_EVENT_DATA_BUFFER", xr::StructureType::EventDataBuffer},
+    {"HandJointsLocateInfoEXT", xr::StructureType::HandJointsLocateInfoEXT},
+    {"XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR", xr::StructureType::CompositionLayerDepthInfoKHR},
+};
+
+// Parses the names in a shuffled order, so that branch prediction can't learn the sequence.
+template <typename E>
+std::vector<std::string> shuffledNames(std::vector<std::pair<std::string, E>> const &entries) {
+  std::vector<std::string> names;
+  std::minstd_rand random;
+  for (size_t i = 0; i < 4096; ++i) { // A power of two, for cheap wrapping.
+    names.push_back(entries[random() % entries.size()].first);
+  }
+  return names;
+}
+
+template <typename E>
+void fromStringPerfectHash(benchmark::State &state, std::vector<std::pair<std::string, E>> const &entries) {
+  const std::vector<std::string> names = shuffledNames(entries);
+  size_t i = 0;
+  for (auto _ : state) {
+    E value{};
+    benchmark::DoNotOptimize(xr::from_string(names[i].data(), names[i].size(), value));
+    benchmark::DoNotOptimize(value);
+    i = (i + 1) & (names.size() - 1);
+  }
+}
+
+// The hand-written alternative: a map built at startup from all of the names, as from_string() knows them.
+template <typename E>
+void fromStringUnorderedMap(benchmark::State &state, std::vector<std::pair<std::string, E>> const &entries) {
+  std::unordered_map<std::string, E> map;
+  for (auto const &slot : xr::impl::EnumValueTable<E>::slots) {
+    if (slot.name != nullptr) {
+      map.emplace(slot.name, static_cast<E>(slot.value));
+    }
+  }
+  const std::vector<std::string> names = shuffledNames(entries);
+  size_t i = 0;
+  for (auto _ : state) {
+    auto it = map.find(names[i]);
+    benchmark::DoNotOptimize(it == map.end() ? E{} : it->second);
+    i = (i + 1) & (names.size() - 1);
+  }
+}
+} // namespace
+
+static void BM_FromStringReferenceSpaceType(benchmark::State &state) {
+  fromStringPerfectHash(state, kReferenceSpaceTypes);
+}
+BENCHMARK(BM_FromStringReferenceSpaceType);
+
+static void BM_UnorderedMapReferenceSpaceType(benchmark::State &state) {
+  fromStringUnorderedMap(state, kReferenceSpaceTypes);
+}
+BENCHMARK(BM_UnorderedMapReferenceSpaceType);
+
+static void BM_FromStringStructureType(benchmark::State &state) { fromStringPerfectHash(state, kStructureTypes); }
+BENCHMARK(BM_FromStringStructureType);
+
+static void BM_UnorderedMapStructureType(benchmark::State &state) { fromStringUnorderedMap(state, kStructureTypes); }
+BENCHMARK(BM_UnorderedMapStructureType);
@@ -0,0 +1,56 @@
+#include "openxr/openxr.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+// Structure types seen when tracing a frame loop, in a shuffled order so that branch prediction can't learn it.
+std::vector<xr::StructureType> shuffledStructureTypes() {
+  const xr::StructureType types[] = {
+      xr::StructureType::FrameWaitInfo,          xr::StructureType::FrameState,
+      xr::StructureType::FrameBeginInfo,         xr::StructureType::FrameEndInfo,
+      xr::StructureType::CompositionLayerProjection, xr::StructureType::SpaceLocation,
+      xr::StructureType::ActionStatePose,        xr::StructureType::EventDataBuffer,
+      xr::StructureType::HandJointsLocateInfoEXT, xr::StructureType::HandJointLocationsEXT,
+      xr::StructureType::CompositionLayerDepthInfoKHR, xr::StructureType::EventDataDisplayRefreshRateChangedFB,
+  };
+  std::vector<xr::StructureType> shuffled;
+  std::minstd_rand random;
+  for (size_t i = 0; i < 4096; ++i) { // A power of two, for cheap wrapping.
+    shuffled.push_back(types[random() % (sizeof(types) / sizeof(types[0]))]);
+  }
+  return shuffled;
+}
+
+struct StructureTypeHash {
+  size_t operator()(xr::StructureType type) const { return std::hash<uint32_t>()(static_cast<uint32_t>(type)); }
+};
+} // namespace
+
+static void BM_EnumIndexCounters(benchmark::State &state) {
+  const std::vector<xr::StructureType> types = shuffledStructureTypes();
+  std::array<uint64_t, xr::enum_count<xr::StructureType>() + 1> counters{};
+  size_t i = 0;
+  for (auto _ : state) {
+    ++counters[xr::enum_index(types[i])];
+    i = (i + 1) & (types.size() - 1);
+  }
+  benchmark::DoNotOptimize(counters);
+}
+BENCHMARK(BM_EnumIndexCounters);
+
+static void BM_UnorderedMapCounters(benchmark::State &state) {
+  const std::vector<xr::StructureType> types = shuffledStructureTypes();
+  std::unordered_map<xr::StructureType, uint64_t, StructureTypeHash> counters;
+  size_t i = 0;
+  for (auto _ : state) {
+    ++counters[types[i]];
+    i = (i + 1) & (types.size() - 1);
+  }
+  benchmark::DoNotOptimize(counters);
+}
+BENCHMARK(BM_UnorderedMapCounters);
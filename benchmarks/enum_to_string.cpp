@@ -0,0 +1,65 @@
+#include "openxr/openxr.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+// Values spread over the core and extension ranges, as seen when tracing a frame loop.
+const std::vector<xr::StructureType> kStructureTypes = {
+    xr::StructureType::FrameWaitInfo,          xr::StructureType::FrameState,
+    xr::StructureType::FrameBeginInfo,         xr::StructureType::FrameEndInfo,
+    xr::StructureType::CompositionLayerProjection, xr::StructureType::CompositionLayerProjectionView,
+    xr::StructureType::SpaceLocation,          xr::StructureType::ActionStateGetInfo,
+    xr::StructureType::ActionStatePose,        xr::StructureType::ActionsSyncInfo,
+    xr::StructureType::EventDataBuffer,        xr::StructureType::SwapchainImageAcquireInfo,
+    xr::StructureType::HandJointsLocateInfoEXT, xr::StructureType::HandJointLocationsEXT,
+    xr::StructureType::CompositionLayerDepthInfoKHR, xr::StructureType::EventDataDisplayRefreshRateChangedFB,
+};
+
+const std::vector<xr::Result> kResults = {
+    xr::Result::Success,
+    xr::Result::SessionLossPending,
+    xr::Result::FrameDiscarded,
+    xr::Result::ErrorValidationFailure,
+    xr::Result::ErrorSessionLost,
+    xr::Result::ErrorSessionNotRunning,
+    xr::Result::ErrorTimeInvalid,
+    xr::Result::ErrorPoseInvalid,
+    xr::Result::ErrorRuntimeUnavailable,
+    xr::Result::ErrorDisplayRefreshRateUnsupportedFB,
+    xr::Result::ErrorSpatialAnchorNameNotFoundMSFT,
+    xr::Result::ErrorColorSpaceUnsupportedFB,
+};
+
+const std::vector<xr::ObjectType> kObjectTypes = {
+    xr::ObjectType::Instance,        xr::ObjectType::Session,           xr::ObjectType::Swapchain,
+    xr::ObjectType::Space,           xr::ObjectType::ActionSet,         xr::ObjectType::Action,
+    xr::ObjectType::DebugUtilsMessengerEXT, xr::ObjectType::SpatialAnchorMSFT, xr::ObjectType::HandTrackerEXT,
+};
+
+// Stringifies the values in a shuffled order, so that branch prediction can't learn the sequence.
+template <typename E>
+void toStringLiteral(benchmark::State &state, std::vector<E> const &values) {
+  std::vector<E> shuffled;
+  std::minstd_rand random;
+  for (size_t i = 0; i < 4096; ++i) { // A power of two, for cheap wrapping.
+    shuffled.push_back(values[random() % values.size()]);
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(xr::to_string_literal(shuffled[i]));
+    i = (i + 1) & (shuffled.size() - 1);
+  }
+}
+} // namespace
+
+static void BM_ToStringLiteralStructureType(benchmark::State &state) { toStringLiteral(state, kStructureTypes); }
+BENCHMARK(BM_ToStringLiteralStructureType);
+
+static void BM_ToStringLiteralResult(benchmark::State &state) { toStringLiteral(state, kResults); }
+BENCHMARK(BM_ToStringLiteralResult);
+
+static void BM_ToStringLiteralObjectType(benchmark::State &state) { toStringLiteral(state, kObjectTypes); }
+BENCHMARK(BM_ToStringLiteralObjectType);
@@ -0,0 +1,108 @@
+#include "openxr/openxr.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+
+// Measures the wrappers that throw on failure.
+#ifndef OPENXR_HPP_NO_EXCEPTIONS
+
+namespace {
+// A runtime whose calls succeed, unless told to fail. The status is atomic so that the compiler can't fold the
+// result checks of consecutive calls together, as it could not with a real runtime.
+struct FrameDispatch {
+  std::atomic<XrResult> status{XR_SUCCESS};
+
+  XrResult xrWaitFrame(XrSession, const XrFrameWaitInfo *, XrFrameState *state) const {
+    state->predictedDisplayTime = 1;
+    return status.load(std::memory_order_relaxed);
+  }
+  XrResult xrBeginFrame(XrSession, const XrFrameBeginInfo *) const { return status.load(std::memory_order_relaxed); }
+  XrResult xrEndFrame(XrSession, const XrFrameEndInfo *) const { return status.load(std::memory_order_relaxed); }
+  XrResult xrGetActionStateBoolean(XrSession, const XrActionStateGetInfo *, XrActionStateBoolean *state) const {
+    state->currentState = XR_TRUE;
+    return status.load(std::memory_order_relaxed);
+  }
+  XrResult xrLocateSpace(XrSpace, XrSpace, XrTime, XrSpaceLocation *location) const {
+    location->locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+    return status.load(std::memory_order_relaxed);
+  }
+  XrResult xrAcquireSwapchainImage(XrSwapchain, const XrSwapchainImageAcquireInfo *, uint32_t *index) const {
+    *index = 0;
+    return status.load(std::memory_order_relaxed);
+  }
+  XrResult xrWaitSwapchainImage(XrSwapchain, const XrSwapchainImageWaitInfo *) const { return status.load(std::memory_order_relaxed); }
+  XrResult xrReleaseSwapchainImage(XrSwapchain, const XrSwapchainImageReleaseInfo *) const { return status.load(std::memory_order_relaxed); }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(FrameDispatch)
+
+// The wrappers a typical frame calls. Kept out of line and away from interprocedural optimization, so that the
+// results of the dispatch are not known at compile time and the function's code size can be inspected with
+// `nm --size-sort`.
+#if defined(__clang__)
+__attribute__((noinline))
+#elif defined(__GNUC__)
+__attribute__((noipa))
+#endif
+static int64_t
+runFrame(FrameDispatch const &d, xr::Session session, xr::Space space, xr::Swapchain swapchain) {
+  const xr::FrameState frameState = session.waitFrame(xr::FrameWaitInfo{}, d);
+  session.beginFrame(xr::FrameBeginInfo{}, d);
+  const xr::ActionStateBoolean select = session.getActionStateBoolean(xr::ActionStateGetInfo{}, d);
+  const xr::ActionStateBoolean menu = session.getActionStateBoolean(xr::ActionStateGetInfo{}, d);
+  const xr::SpaceLocation location = space.locateSpace(space, frameState.predictedDisplayTime, d);
+  const uint32_t image = swapchain.acquireSwapchainImage(xr::SwapchainImageAcquireInfo{}, d);
+  swapchain.waitSwapchainImage(xr::SwapchainImageWaitInfo{xr::Duration::infinite()}, d);
+  swapchain.releaseSwapchainImage(xr::SwapchainImageReleaseInfo{}, d);
+  session.endFrame(xr::FrameEndInfo{}, d);
+  return frameState.predictedDisplayTime.get() + int64_t(select.currentState.get()) + int64_t(menu.currentState.get()) +
+         int64_t(location.locationFlags.get()) + image;
+}
+
+static void BM_EnhancedWrappersSuccess(benchmark::State &state) {
+  FrameDispatch d;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(runFrame(d, xr::Session{}, xr::Space{}, xr::Swapchain{}));
+  }
+}
+BENCHMARK(BM_EnhancedWrappersSuccess);
+
+static void BM_EnhancedWrapperThrow(benchmark::State &state) {
+  FrameDispatch d;
+  d.status.store(XR_ERROR_SESSION_LOST);
+  for (auto _ : state) {
+    try {
+      benchmark::DoNotOptimize(runFrame(d, xr::Session{}, xr::Space{}, xr::Swapchain{}));
+    } catch (xr::exceptions::SessionLostError const &) {
+    }
+  }
+}
+BENCHMARK(BM_EnhancedWrapperThrow);
+
+// A burst of session-lost errors, as after a runtime reports a pending session loss, caught without looking at the
+// message.
+static void BM_ThrowCatchStorm(benchmark::State &state) {
+  for (auto _ : state) {
+    try {
+      xr::exceptions::throwResultException(xr::Result::ErrorSessionLost, "xr::Session::waitFrame");
+    } catch (xr::exceptions::Error const &e) {
+      benchmark::DoNotOptimize(&e);
+    }
+  }
+}
+BENCHMARK(BM_ThrowCatchStorm);
+
+static void BM_ThrowCatchWhat(benchmark::State &state) {
+  for (auto _ : state) {
+    try {
+      xr::exceptions::throwResultException(xr::Result::ErrorSessionLost, "xr::Session::waitFrame");
+    } catch (xr::exceptions::Error const &e) {
+      benchmark::DoNotOptimize(e.what());
+    }
+  }
+}
+BENCHMARK(BM_ThrowCatchWhat);
+
+#endif // !OPENXR_HPP_NO_EXCEPTIONS
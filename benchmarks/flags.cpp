@@ -0,0 +1,86 @@
+#include "openxr/openxr.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+// Sparse random masks over the low 16 bits, like the flags of a swapchain or a space location.
+std::vector<xr::SwapchainUsageFlags> randomFlags() {
+  std::vector<xr::SwapchainUsageFlags> flags;
+  std::minstd_rand random;
+  for (size_t i = 0; i < 4096; ++i) { // A power of two, for cheap wrapping.
+    flags.emplace_back(uint64_t(random() & random() & 0xFFFF));
+  }
+  return flags;
+}
+
+std::vector<xr::SpaceLocationFlags> randomLocationFlags() {
+  std::vector<xr::SpaceLocationFlags> flags;
+  std::minstd_rand random;
+  for (size_t i = 0; i < 4096; ++i) {
+    flags.emplace_back(uint64_t(random() & 0xF));
+  }
+  return flags;
+}
+} // namespace
+
+// Checking a whole hand's worth of joint locations for validity.
+static void BM_LocationFlagsAllValid(benchmark::State &state) {
+  const std::vector<xr::SpaceLocationFlags> flags = randomLocationFlags();
+  const xr::SpaceLocationFlags valid = xr::SpaceLocationFlagBits::PositionValid |
+                                       xr::SpaceLocationFlagBits::OrientationValid;
+  size_t i = 0;
+  for (auto _ : state) {
+    uint32_t validMask = 0;
+    for (uint32_t joint = 0; joint < XR_HAND_JOINT_COUNT_EXT; ++joint) {
+      validMask |= uint32_t(flags[i + joint].all(valid)) << joint;
+    }
+    benchmark::DoNotOptimize(validMask);
+    i = (i + 32) & (flags.size() - 1); // Room for a hand per step, without wrapping mid-hand.
+  }
+}
+BENCHMARK(BM_LocationFlagsAllValid);
+
+static void BM_FlagsIterateSetBits(benchmark::State &state) {
+  const std::vector<xr::SwapchainUsageFlags> flags = randomFlags();
+  size_t i = 0;
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (xr::SwapchainUsageFlagBits bit : flags[i]) {
+      sum += uint64_t(bit);
+    }
+    benchmark::DoNotOptimize(sum);
+    i = (i + 1) & (flags.size() - 1);
+  }
+}
+BENCHMARK(BM_FlagsIterateSetBits);
+
+// The loop that iterating replaces: testing each of the 64 bit positions.
+static void BM_FlagsTestEachBit(benchmark::State &state) {
+  const std::vector<xr::SwapchainUsageFlags> flags = randomFlags();
+  size_t i = 0;
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (uint32_t position = 0; position < 64; ++position) {
+      const auto bit = static_cast<xr::SwapchainUsageFlagBits>(uint64_t(1) << position);
+      if (flags[i] & bit) {
+        sum += uint64_t(bit);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    i = (i + 1) & (flags.size() - 1);
+  }
+}
+BENCHMARK(BM_FlagsTestEachBit);
+
+static void BM_FlagsCount(benchmark::State &state) {
+  const std::vector<xr::SwapchainUsageFlags> flags = randomFlags();
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(flags[i].count());
+    i = (i + 1) & (flags.size() - 1);
+  }
+}
+BENCHMARK(BM_FlagsCount);
@@ -0,0 +1,89 @@
+#include "openxr/openxr_format.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+// Space locations as logged by telemetry, with varied values so that number formatting does real work.
+std::vector<xr::SpaceLocation> randomLocations() {
+  std::vector<xr::SpaceLocation> locations(4096); // A power of two, for cheap wrapping.
+  std::minstd_rand random;
+  std::uniform_real_distribution<float> distribution(-2.f, 2.f);
+  for (xr::SpaceLocation &location : locations) {
+    location.locationFlags = xr::SpaceLocationFlagBits::OrientationValid | xr::SpaceLocationFlagBits::PositionValid;
+    location.pose.orientation = xr::Quaternionf{distribution(random), distribution(random), distribution(random), 1};
+    location.pose.position = xr::Vector3f{distribution(random), distribution(random), distribution(random)};
+  }
+  return locations;
+}
+} // namespace
+
+static void BM_FormatToSpaceLocation(benchmark::State &state) {
+  const std::vector<xr::SpaceLocation> locations = randomLocations();
+  char text[256];
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(xr::format_to(text, locations[i]));
+    benchmark::ClobberMemory();
+    i = (i + 1) & (locations.size() - 1);
+  }
+}
+BENCHMARK(BM_FormatToSpaceLocation);
+
+// The same text built by hand with snprintf, which does not allocate but parses its format string every call.
+static void BM_SnprintfSpaceLocation(benchmark::State &state) {
+  const std::vector<xr::SpaceLocation> locations = randomLocations();
+  char text[256];
+  size_t i = 0;
+  for (auto _ : state) {
+    const xr::SpaceLocation &location = locations[i];
+    const xr::Posef &pose = location.pose;
+    benchmark::DoNotOptimize(snprintf(
+        text, sizeof(text), "{locationFlags: %s, pose: {orientation: {x: %.9g, y: %.9g, z: %.9g, w: %.9g}, position: {x: %.9g, y: %.9g, z: %.9g}}}",
+        xr::to_string(location.locationFlags).c_str(), pose.orientation.x, pose.orientation.y, pose.orientation.z,
+        pose.orientation.w, pose.position.x, pose.position.y, pose.position.z));
+    benchmark::ClobberMemory();
+    i = (i + 1) & (locations.size() - 1);
+  }
+}
+BENCHMARK(BM_SnprintfSpaceLocation);
+
+// The std::string concatenation that telemetry used before format_to().
+static void BM_StringConcatSpaceLocation(benchmark::State &state) {
+  const std::vector<xr::SpaceLocation> locations = randomLocations();
+  size_t i = 0;
+  for (auto _ : state) {
+    const xr::SpaceLocation &location = locations[i];
+    const xr::Posef &pose = location.pose;
+    std::string text = "{locationFlags: " + xr::to_string(location.locationFlags) + ", pose: {orientation: {x: " +
+                       std::to_string(pose.orientation.x) + ", y: " + std::to_string(pose.orientation.y) +
+                       ", z: " + std::to_string(pose.orientation.z) + ", w: " + std::to_string(pose.orientation.w) +
+                       "}, position: {x: " + std::to_string(pose.position.x) + ", y: " +
+                       std::to_string(pose.position.y) + ", z: " + std::to_string(pose.position.z) + "}}}";
+    benchmark::DoNotOptimize(text);
+    i = (i + 1) & (locations.size() - 1);
+  }
+}
+BENCHMARK(BM_StringConcatSpaceLocation);
+
+static void BM_FormatToVersion(benchmark::State &state) {
+  const xr::Version version{1, 0, 34};
+  char text[32];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(xr::format_to(text, version));
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_FormatToVersion);
+
+static void BM_ToStringVersion(benchmark::State &state) {
+  const xr::Version version{1, 0, 34};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(xr::to_string(version));
+  }
+}
+BENCHMARK(BM_ToStringVersion);
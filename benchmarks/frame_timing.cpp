@@ -0,0 +1,81 @@
+#include "openxr/openxr_frame_timing.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+namespace {
+struct NullFrameDispatch {
+  XrTime displayTime = 0;
+
+  XrResult xrWaitFrame(XrSession, const XrFrameWaitInfo *, XrFrameState *state) {
+    displayTime += 11111111;
+    state->predictedDisplayTime = displayTime;
+    state->predictedDisplayPeriod = 11111111;
+    state->shouldRender = XR_TRUE;
+    return XR_SUCCESS;
+  }
+  XrResult xrBeginFrame(XrSession, const XrFrameBeginInfo *) { return XR_SUCCESS; }
+  XrResult xrEndFrame(XrSession, const XrFrameEndInfo *) { return XR_SUCCESS; }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(NullFrameDispatch)
+
+// The frame calls alone, as a baseline for the recorder's overhead.
+static void BM_FrameCallsUnrecorded(benchmark::State &state) {
+  NullFrameDispatch d;
+  xr::FrameState frameState;
+  for (auto _ : state) {
+    d.xrWaitFrame(XR_NULL_HANDLE, xr::FrameWaitInfo{}.get(), frameState.put());
+    d.xrBeginFrame(XR_NULL_HANDLE, xr::FrameBeginInfo{}.get());
+    d.xrEndFrame(XR_NULL_HANDLE, xr::FrameEndInfo{}.get());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_FrameCallsUnrecorded);
+
+static void BM_FrameCallsRecorded(benchmark::State &state) {
+  NullFrameDispatch d;
+  xr::FrameTimingRecorder<> recorder;
+  xr::FrameState frameState;
+  for (auto _ : state) {
+    recorder.waitFrame(xr::Session{}, xr::FrameWaitInfo{}, frameState, d);
+    recorder.beginFrame(xr::Session{}, xr::FrameBeginInfo{}, d);
+    recorder.endFrame(xr::Session{}, xr::FrameEndInfo{}, d);
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_FrameCallsRecorded);
+
+static void BM_FrameTimingAddSample(benchmark::State &state) {
+  xr::FrameTimingRecorder<> recorder;
+  xr::FrameTimingSample sample;
+  sample.predictedDisplayPeriod = xr::Duration{11111111};
+  int64_t frame = 0;
+  for (auto _ : state) {
+    ++frame;
+    sample.predictedDisplayTime = xr::Time{frame * 11111111};
+    sample.waitTime = xr::Duration{(frame % 97) * 50000};
+    sample.cpuTime = xr::Duration{(frame % 89) * 60000};
+    recorder.addSample(sample);
+  }
+}
+BENCHMARK(BM_FrameTimingAddSample);
+
+static void BM_FrameTimingSnapshot(benchmark::State &state) {
+  xr::FrameTimingRecorder<> recorder;
+  for (int64_t frame = 1; frame <= 1000; ++frame) {
+    xr::FrameTimingSample sample;
+    sample.predictedDisplayTime = xr::Time{frame * 11111111};
+    sample.predictedDisplayPeriod = xr::Duration{11111111};
+    sample.waitTime = xr::Duration{(frame % 97) * 50000};
+    recorder.addSample(sample);
+  }
+  xr::FrameTimingSnapshot snapshot;
+  for (auto _ : state) {
+    recorder.snapshot(snapshot);
+    benchmark::DoNotOptimize(snapshot.waitTime.percentile(0.99));
+  }
+}
+BENCHMARK(BM_FrameTimingSnapshot);
@@ -0,0 +1,80 @@
+#include "openxr/openxr_hash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+// Swapchain create-infos of a few sizes and formats, as requested by a compositor, in a shuffled order.
+std::vector<xr::SwapchainCreateInfo> randomCreateInfos() {
+  std::vector<xr::SwapchainCreateInfo> infos(4096); // A power of two, for cheap wrapping.
+  std::minstd_rand random;
+  for (xr::SwapchainCreateInfo &info : infos) {
+    info.usageFlags = xr::SwapchainUsageFlagBits::ColorAttachment | xr::SwapchainUsageFlagBits::Sampled;
+    info.format = 43 + int64_t(random() % 4);
+    info.sampleCount = 1;
+    info.width = 512u << (random() % 4);
+    info.height = info.width;
+    info.faceCount = 1;
+    info.arraySize = 1 + random() % 2;
+    info.mipCount = 1;
+  }
+  return infos;
+}
+
+// Byte-wise FNV-1a over the members, as a typical hand-written hash.
+struct Fnv1aHash {
+  size_t operator()(xr::SwapchainCreateInfo const &info) const {
+    uint64_t hash = 14695981039346656037u;
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&info.createFlags);
+    const unsigned char *end = reinterpret_cast<const unsigned char *>(&info.mipCount + 1);
+    for (; bytes != end; ++bytes) {
+      hash = (hash ^ *bytes) * 1099511628211u;
+    }
+    return static_cast<size_t>(hash);
+  }
+};
+
+template <typename Hash>
+void hashCreateInfos(benchmark::State &state) {
+  const std::vector<xr::SwapchainCreateInfo> infos = randomCreateInfos();
+  Hash hash;
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hash(infos[i]));
+    i = (i + 1) & (infos.size() - 1);
+  }
+}
+
+template <typename Hash>
+void lookUpCreateInfos(benchmark::State &state) {
+  const std::vector<xr::SwapchainCreateInfo> infos = randomCreateInfos();
+  std::unordered_map<xr::SwapchainCreateInfo, int, Hash> cache;
+  for (xr::SwapchainCreateInfo const &info : infos) {
+    cache.emplace(info, 0);
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache.find(infos[i]));
+    i = (i + 1) & (infos.size() - 1);
+  }
+}
+} // namespace
+
+static void BM_StdHashSwapchainCreateInfo(benchmark::State &state) {
+  hashCreateInfos<std::hash<xr::SwapchainCreateInfo>>(state);
+}
+BENCHMARK(BM_StdHashSwapchainCreateInfo);
+
+static void BM_Fnv1aSwapchainCreateInfo(benchmark::State &state) { hashCreateInfos<Fnv1aHash>(state); }
+BENCHMARK(BM_Fnv1aSwapchainCreateInfo);
+
+static void BM_CacheLookupStdHash(benchmark::State &state) {
+  lookUpCreateInfos<std::hash<xr::SwapchainCreateInfo>>(state);
+}
+BENCHMARK(BM_CacheLookupStdHash);
+
+static void BM_CacheLookupFnv1a(benchmark::State &state) { lookUpCreateInfos<Fnv1aHash>(state); }
+BENCHMARK(BM_CacheLookupFnv1a);
@@ -0,0 +1,116 @@
+#include "openxr/openxr_serialize.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+struct HandJoints {
+  xr::HandJointLocationEXT joints[XR_HAND_JOINT_COUNT_EXT];
+};
+
+// Tracked hands as a session recorder captures them each frame.
+std::vector<HandJoints> randomHands() {
+  std::vector<HandJoints> hands(4096); // A power of two, for cheap wrapping.
+  std::minstd_rand random;
+  std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+  for (HandJoints &hand : hands) {
+    for (xr::HandJointLocationEXT &joint : hand.joints) {
+      joint.locationFlags = xr::SpaceLocationFlagBits::OrientationValid | xr::SpaceLocationFlagBits::PositionValid;
+      joint.pose.orientation = xr::Quaternionf{distribution(random), distribution(random), distribution(random), 1};
+      joint.pose.position = xr::Vector3f{distribution(random), distribution(random), distribution(random)};
+      joint.radius = 0.01f;
+    }
+  }
+  return hands;
+}
+
+// A typical hand-written recorder, writing each member little-endian in turn.
+unsigned char *writeBytes(unsigned char *out, uint64_t value, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    *out++ = static_cast<unsigned char>(value >> (8 * i));
+  }
+  return out;
+}
+
+unsigned char *writeFloat(unsigned char *out, float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return writeBytes(out, bits, sizeof(bits));
+}
+
+size_t writeByHand(unsigned char *out, HandJoints const &hand) {
+  unsigned char *const start = out;
+  for (xr::HandJointLocationEXT const &joint : hand.joints) {
+    out = writeBytes(out, joint.locationFlags.get(), sizeof(XrSpaceLocationFlags));
+    out = writeFloat(out, joint.pose.orientation.x);
+    out = writeFloat(out, joint.pose.orientation.y);
+    out = writeFloat(out, joint.pose.orientation.z);
+    out = writeFloat(out, joint.pose.orientation.w);
+    out = writeFloat(out, joint.pose.position.x);
+    out = writeFloat(out, joint.pose.position.y);
+    out = writeFloat(out, joint.pose.position.z);
+    out = writeFloat(out, joint.radius);
+  }
+  return size_t(out - start);
+}
+} // namespace
+
+static void BM_SerializeHandJoints(benchmark::State &state) {
+  const std::vector<HandJoints> hands = randomHands();
+  unsigned char bytes[sizeof(HandJoints)];
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(xr::serialize(bytes, sizeof(bytes), hands[i].joints));
+    benchmark::DoNotOptimize(bytes);
+    benchmark::ClobberMemory();
+    i = (i + 1) & (hands.size() - 1);
+  }
+}
+BENCHMARK(BM_SerializeHandJoints);
+
+static void BM_WriteByHandHandJoints(benchmark::State &state) {
+  const std::vector<HandJoints> hands = randomHands();
+  unsigned char bytes[sizeof(HandJoints)];
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(writeByHand(bytes, hands[i]));
+    benchmark::DoNotOptimize(bytes);
+    benchmark::ClobberMemory();
+    i = (i + 1) & (hands.size() - 1);
+  }
+}
+BENCHMARK(BM_WriteByHandHandJoints);
+
+static void BM_DeserializeHandJoints(benchmark::State &state) {
+  const std::vector<HandJoints> hands = randomHands();
+  std::vector<unsigned char> bytes(sizeof(HandJoints) * hands.size());
+  for (size_t i = 0; i < hands.size(); ++i) {
+    xr::serialize(&bytes[i * sizeof(HandJoints)], sizeof(HandJoints), hands[i].joints);
+  }
+  HandJoints hand;
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(xr::deserialize(&bytes[i * sizeof(HandJoints)], sizeof(HandJoints), hand.joints));
+    benchmark::DoNotOptimize(hand);
+    benchmark::ClobberMemory();
+    i = (i + 1) & (hands.size() - 1);
+  }
+}
+BENCHMARK(BM_DeserializeHandJoints);
+
+static void BM_SerializeSpaceLocation(benchmark::State &state) {
+  const std::vector<HandJoints> hands = randomHands();
+  xr::SpaceLocation location;
+  unsigned char bytes[64];
+  size_t i = 0;
+  for (auto _ : state) {
+    location.pose = hands[i].joints[0].pose;
+    benchmark::DoNotOptimize(xr::serialize(bytes, sizeof(bytes), location));
+    benchmark::DoNotOptimize(bytes);
+    benchmark::ClobberMemory();
+    i = (i + 1) & (hands.size() - 1);
+  }
+}
+BENCHMARK(BM_SerializeSpaceLocation);
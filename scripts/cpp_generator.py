@@ -17,9 +17,11 @@
 # limitations under the License.
 
 import re
+from types import SimpleNamespace
 
 from automatic_source_generator import AutomaticSourceOutputGenerator, write
-from jinja_helpers import JinjaTemplate, make_jinja_environment
+from jinja_helpers import JinjaTemplate, _protect_begin, make_jinja_environment
+from perfect_hash import build_name_table, build_perfect_hash
 
 VALID_FOR_NULL_INSTANCE = set((
     'xrEnumerateInstanceExtensionProperties',
@@ -47,6 +49,10 @@ MANUALLY_PROJECTED = set((
 
 TWO_CALL_STRING_NAME = "buffer"
 
+# The largest enum that still looks up its names in a switch. Larger enums, spread too sparsely for a switch to
+# become a jump table, look up their names in a perfect hash table instead.
+ENUM_NAME_SWITCH_MAX_VALUES = 8
+
 RULE_BREAKING_ENUMS = {
     'XrResult': 'XR',
     'XrStructureType': 'XR_TYPE',
@@ -136,6 +142,10 @@ def _is_static_length_string(member):
     return member.type == "char" and member.is_array and member.pointer_count == 0
 
 
+def _has_caller_allocated_buffer(struct):
+    return any(m.pointer_count > 0 and not m.is_const and m.name != "next" for m in struct.members)
+
+
 def _block_comment(s, doxygen=False):
     def clean_line(line):
         line = line.rstrip()
@@ -217,6 +227,9 @@ class StructProjection:
 
         self.struct_type_enum = gen._get_tag(struct.name) if self.has_type_enum_value else None
 
+        # Fixed-size strings are copied in the body of the full initializing constructor, so it cannot be constexpr.
+        self.full_constructor_is_constexpr = not any(_is_static_length_string(m) for m in struct.members)
+
     @property
     def struct_parent_decl(self):
         if self.typed_struct:
@@ -314,6 +327,9 @@ class MethodProjection:
         self.explicit_result_elided = False
         """If true, our most advanced enhanced wrapper doesn't have an XrResult anywhere."""
 
+        self.returns_expected = False
+        """If true, return the output in an Expected rather than alongside the Result (for OPENXR_HPP_EXPECTED)."""
+
     @property
     def qualified_name(self):
         if self.handle and self.is_member_function:
@@ -402,6 +418,7 @@ class CppGenerator(AutomaticSourceOutputGenerator):
 
     def __init__(self, *args, **kwargs):
         self.quiet = kwargs.pop('quiet', False)
+        self.enum_name_switch_max_values = kwargs.pop('enum_name_switch_max_values', ENUM_NAME_SWITCH_MAX_VALUES)
         super().__init__(*args, **kwargs)
         self.env = make_jinja_environment(file_with_templates_as_sibs=__file__, trim_blocks=False)
         self.env.filters['block_doxygen_comment'] = _block_doxygen_comment
@@ -491,6 +508,100 @@ class CppGenerator(AutomaticSourceOutputGenerator):
             result += suffix
         return result
 
+    def _enum_value_number(self, val):
+        num, _ = self.enumToValue(self.registry.enumdict[val.name].elem, True)
+        return num
+
+    def _sorted_enum_values(self, enum):
+        """Return the non-alias values of an enum, in order of their numeric values."""
+        return sorted((val for val in enum.values if not val.alias), key=self._enum_value_number)
+
+    def _enum_name_table(self, enum):
+        """Return a perfect hash table from the values of an enum to their projected names.
+
+        Each slot is a (value as uint32_t, name) pair, or None. Returns None for enums that are small or dense enough
+        to leave to a switch.
+        """
+        values = [val for val in enum.values if not val.alias]
+        if len(values) <= self.enum_name_switch_max_values:
+            return None
+        numbers = [self._enum_value_number(val) for val in values]
+        if max(numbers) - min(numbers) < 2 * len(values):
+            return None
+        keys = [num & 0xFFFFFFFF for num in numbers]
+        table = build_perfect_hash(keys)
+        table.slots = [None if i is None else (keys[i], self.createEnumValue(values[i].name, enum.name))
+                       for i in table.slots]
+        return table
+
+    def _flag_bit_names(self, flags):
+        """Return the projected names of the bits of a flags type, indexed by bit position, with None for gaps."""
+        names = {}
+        for val in self._bitmask_for_flags(flags).values:
+            num = self._enum_value_number(val)
+            if val.alias or num <= 0 or num & (num - 1):
+                continue
+            names[num.bit_length() - 1] = self.createFlagValue(val.name, flags.valid_flags)
+        if not names:
+            return [None]
+        return [names.get(position) for position in range(max(names) + 1)]
+
+    def _enum_index_table(self, enum):
+        """Return how enum_index() finds the position of a value of an enum in enum_values().
+
+        Only the values that are compiled in are listed, so they are split into runs of consecutive values under the
+        same guards. The result has:
+
+        - runs: the runs, as lists of non-alias values in declaration order.
+        - dense: whether there is a single unguarded run of consecutive values, whose index is the value minus first.
+        - seeds and slots: otherwise, a perfect hash table over the values. Each slot is a (value as uint32_t, run
+          index, offset in run) tuple, or None.
+        """
+        runs = []
+        run_guard = None
+        for val in enum.values:
+            if val.alias:
+                continue
+            guard = _protect_begin(val, enum)
+            if not runs or guard != run_guard:
+                runs.append([])
+                run_guard = guard
+            runs[-1].append(val)
+        numbers = [self._enum_value_number(val) for run in runs for val in run]
+        first = numbers[0] if numbers else 0
+        if len(runs) <= 1 and not run_guard and numbers == list(range(first, first + len(numbers))):
+            return SimpleNamespace(runs=runs, dense=True, first=first)
+
+        positions = [(r, offset) for r, run in enumerate(runs) for offset in range(len(run))]
+        keys = [num & 0xFFFFFFFF for num in numbers]
+        table = build_perfect_hash(keys)
+        slots = [None if i is None else (keys[i],) + positions[i] for i in table.slots]
+        return SimpleNamespace(runs=runs, dense=False, first=first, seeds=table.seeds, slots=slots)
+
+    def _named_value_table(self, values, projected_name):
+        """Return a perfect hash table from the names of enum or flag bit values to the values.
+
+        Both the projected name, as returned by to_string_literal(), and the C name are keys. Each slot is a
+        (name, numeric value) pair, or None.
+        """
+        entries = []
+        for val in values:
+            if val.alias:
+                continue
+            num = self._enum_value_number(val)
+            entries.append((projected_name(val), num))
+            entries.append((val.name, num))
+        table = build_name_table([name for name, _ in entries])
+        table.slots = [None if i is None else entries[i] for i in table.slots]
+        return table
+
+    def _enum_value_table(self, enum):
+        return self._named_value_table(enum.values, lambda val: self.createEnumValue(val.name, enum.name))
+
+    def _flag_value_table(self, flags):
+        return self._named_value_table(self._bitmask_for_flags(flags).values,
+                                       lambda val: self.createFlagValue(val.name, flags.valid_flags))
+
     def _basic_method_projection(self, method):
         """Perform the basic manipulation of a MethodProjection to convert it from C to C++."""
 
@@ -538,7 +649,7 @@ class CppGenerator(AutomaticSourceOutputGenerator):
                         cpp_type, name)
                     method.pre_statements.append(
                         "{} {}_tmp;".format(param.type, name.strip()))
-                    method.access_dict[name] = "{}_tmp".format(name.strip())
+                    method.access_dict[name] = "&{}_tmp".format(name.strip())
                     method.post_statements.append(
                         "{name} = static_cast<{t}>({name}_tmp);".format(name=name.strip(), t=cpp_type))
 
@@ -558,7 +669,11 @@ class CppGenerator(AutomaticSourceOutputGenerator):
             elif param.pointer_count == 1 and not is_two_call:
                 # Output struct
                 method.decl_dict[name] = "{}& {}".format(cpp_type, name)
-                method.access_dict[name] = "{}.put()".format(name.strip())
+                if _has_caller_allocated_buffer(self.dict_structs[param.type]):
+                    # Clearing would discard the buffer the caller set up for the runtime to fill.
+                    method.access_dict[name] = "{}.put(false)".format(name.strip())
+                else:
+                    method.access_dict[name] = "{}.put()".format(name.strip())
 
         # Convert atoms, plus XrTime and XrDuration as special case (promoted from raw ints to constexpr wrapper classes)
         for param in method.decl_params:
@@ -573,6 +688,16 @@ class CppGenerator(AutomaticSourceOutputGenerator):
         """Set the return type based on the bare return type.
 
         Used by _enhanced_method_projection and _unique_method_projection."""
+        if method.returns_expected and not method.multiple_success_codes and method.bare_return_type != "void":
+            # Return either the output or the error, taking the error path through a cold out-of-line helper.
+            method.return_type = "Expected<{}>".format(method.bare_return_type)
+            if method.return_template_params:
+                return_val = "{}({})".format(method.bare_return_type, ", ".join(method.returns[1:]))
+            else:
+                return_val = "std::move({})".format(method.returns[1])
+            method.return_statement = "if (OPENXR_HPP_UNLIKELY(!succeeded({result}))) {{\n    return impl::makeUnexpected({result});\n}}\nreturn {{{val}}};".format(
+                result=method.returns[0], val=return_val)
+            return
         if method.multiple_success_codes or not method.exceptions_permitted:
             # If we aren't allowed exceptions, or have some extra success results,
             # we always have to return the Result.
@@ -810,7 +935,14 @@ class CppGenerator(AutomaticSourceOutputGenerator):
             method.decl_params.pop()
             method.decl_dict[outparam.name] = None
             method.pre_statements.append("{} returnVal;".format(cpp_outtype))
-            if outparam.type in self.projected_types:
+            if outparam.type in self.dict_enums:
+                # Projected enums have the same representation, but no put(): write straight into returnVal,
+                # instead of through the temporary used for output enum parameters.
+                tmp = "{}_tmp".format(outparam.name.strip())
+                method.pre_statements = [x for x in method.pre_statements if tmp not in x]
+                method.post_statements = [x for x in method.post_statements if tmp not in x]
+                method.access_dict[outparam.name] = "reinterpret_cast<{}*>(&returnVal)".format(outparam.type)
+            elif outparam.type in self.projected_types:
                 method.access_dict[outparam.name] = "OPENXR_HPP_NAMESPACE::put(returnVal)"
             else:
                 method.access_dict[outparam.name] = "&returnVal"
@@ -1055,8 +1187,10 @@ class CppGenerator(AutomaticSourceOutputGenerator):
         basic_cmds = {}
         enhanced_cmds = {}
         enhanced_cmds_no_exceptions = {}
+        enhanced_cmds_expected = {}
         unique_cmds = {}
         unique_cmds_no_exceptions = {}
+        unique_cmds_expected = {}
         for cmd in sorted_cmds:
             basic = MethodProjection(cmd, self)
             self._basic_method_projection(basic)
@@ -1073,6 +1207,13 @@ class CppGenerator(AutomaticSourceOutputGenerator):
                 self._enhanced_method_projection(enhanced_noexcept)
                 enhanced_cmds_no_exceptions[cmd.name] = enhanced_noexcept
 
+                # And one returning an Expected.
+                enhanced_expected = MethodProjection(cmd, self)
+                enhanced_expected.exceptions_permitted = False
+                enhanced_expected.returns_expected = True
+                self._enhanced_method_projection(enhanced_expected)
+                enhanced_cmds_expected[cmd.name] = enhanced_expected
+
             if enhanced.is_create:
                 unique = MethodProjection(cmd, self)
                 self._unique_method_projection(unique)
@@ -1085,6 +1226,12 @@ class CppGenerator(AutomaticSourceOutputGenerator):
                     unique_noexcept.exceptions_permitted = False
                     self._unique_method_projection(unique_noexcept)
                     unique_cmds_no_exceptions[cmd.name] = unique_noexcept
+
+                    unique_expected = MethodProjection(cmd, self)
+                    unique_expected.exceptions_permitted = False
+                    unique_expected.returns_expected = True
+                    self._unique_method_projection(unique_expected)
+                    unique_cmds_expected[cmd.name] = unique_expected
                 else:
                     # assumption violated
                     assert(False)
@@ -1101,11 +1248,19 @@ class CppGenerator(AutomaticSourceOutputGenerator):
             project_type_name=_project_type_name,
             result_enum=result_enum,
             create_enum_exception=self.createEnumException,
+            sorted_enum_values=self._sorted_enum_values,
+            enum_name_table=self._enum_name_table,
+            enum_value_table=self._enum_value_table,
+            enum_index_table=self._enum_index_table,
+            flag_bit_names=self._flag_bit_names,
+            flag_value_table=self._flag_value_table,
             basic_cmds=basic_cmds,
             enhanced_cmds=enhanced_cmds,
             enhanced_cmds_no_exceptions=enhanced_cmds_no_exceptions,
             unique_cmds=unique_cmds,
             unique_cmds_no_exceptions=unique_cmds_no_exceptions,
+            enhanced_cmds_expected=enhanced_cmds_expected,
+            unique_cmds_expected=unique_cmds_expected,
             discouraged_begin=_discouraged_begin,
             discouraged_end=_discouraged_end,
             generate_structure_type_from_name=self.conventions.generate_structure_type_from_name,
@@ -45,14 +45,42 @@
 #endif
 #endif  // !OPENXR_HPP_INLINE
 
-#if !defined(OPENXR_HPP_CONSTEXPR)
-#if defined(_MSC_VER) && (_MSC_VER <= 1800)
-#define OPENXR_HPP_CONSTEXPR
+#if !defined(OPENXR_HPP_NOINLINE_COLD)
+#if defined(__GNUC__) || defined(__clang__)
+#define OPENXR_HPP_NOINLINE_COLD __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define OPENXR_HPP_NOINLINE_COLD __declspec(noinline)
 #else
-#define OPENXR_HPP_CONSTEXPR constexpr
+#define OPENXR_HPP_NOINLINE_COLD
+#endif
+#endif  // !OPENXR_HPP_NOINLINE_COLD
+
+#if !defined(OPENXR_HPP_LIKELY)
+#if defined(__GNUC__) || defined(__clang__)
+#define OPENXR_HPP_LIKELY(x) __builtin_expect(!!(x), 1)
+#define OPENXR_HPP_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define OPENXR_HPP_LIKELY(x) (x)
+#define OPENXR_HPP_UNLIKELY(x) (x)
+#endif
+#endif  // !OPENXR_HPP_LIKELY
+
+#if defined(_MSC_VER) && (_MSC_VER <= 1800)
+#error "OpenXR-Hpp requires Visual Studio 2015 or newer, for constexpr static data members and noexcept."
 #endif
+
+#if !defined(OPENXR_HPP_CONSTEXPR)
+#define OPENXR_HPP_CONSTEXPR constexpr
 #endif  // !OPENXR_HPP_CONSTEXPR
 
+#if !defined(OPENXR_HPP_CONSTEXPR_14)
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define OPENXR_HPP_CONSTEXPR_14 constexpr
+#else
+#define OPENXR_HPP_CONSTEXPR_14
+#endif
+#endif  // !OPENXR_HPP_CONSTEXPR_14
+
 #if !defined(OPENXR_HPP_SWITCH_CONSTEXPR)
 //! @todo set this to constexpr in c++14
 #define OPENXR_HPP_SWITCH_CONSTEXPR
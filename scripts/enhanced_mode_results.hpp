@@ -57,4 +57,167 @@ struct ResultValue {
     operator std::tuple<Result const&, T const&>() const { return std::tuple<Result const&, T const&>(result, value); }
 };
 
+#ifdef OPENXR_HPP_HAS_STD_EXPECTED
+/*!
+ * @brief Either a returned value or the error Result: `std::expected<T, Result>`.
+ *
+ * Returned instead of the value alone when `OPENXR_HPP_EXPECTED` is defined. Before C++23, a minimal equivalent is
+ * provided instead.
+ *
+ * @ingroup return_results
+ */
+template <typename T>
+using Expected = std::expected<T, Result>;
+
+/*!
+ * @brief The error Result used to construct a failed Expected: `std::unexpected<Result>`.
+ *
+ * @ingroup return_results
+ */
+using Unexpected = std::unexpected<Result>;
+#else
+/*!
+ * @brief The error Result used to construct a failed Expected, like `std::unexpected<Result>`.
+ *
+ * @ingroup return_results
+ */
+class Unexpected {
+   public:
+    OPENXR_HPP_CONSTEXPR explicit Unexpected(Result result) noexcept : result_(result) {}
+
+    OPENXR_HPP_CONSTEXPR Result error() const noexcept { return result_; }
+
+   private:
+    Result result_;
+};
+
+/*!
+ * @brief Either a returned value or the error Result, like `std::expected<T, Result>` from C++23.
+ *
+ * Returned instead of the value alone when `OPENXR_HPP_EXPECTED` is defined. Provides the commonly used subset of the
+ * `std::expected` interface, with accessing a missing value asserted rather than thrown. On C++23, this is an alias for
+ * `std::expected<T, Result>`.
+ *
+ * @ingroup return_results
+ */
+template <typename T>
+class Expected {
+    template <typename U>
+    using EnableIfValue = typename std::enable_if<std::is_constructible<T, U&&>::value &&
+                                                  !std::is_same<typename std::decay<U>::type, Expected>::value &&
+                                                  !std::is_same<typename std::decay<U>::type, Unexpected>::value>::type;
+
+   public:
+    using value_type = T;
+    using error_type = Result;
+
+    //! Hold a value constructed from @p value.
+    template <typename U = T, typename = EnableIfValue<U>>
+    Expected(U&& value) : hasValue_(true), result_(Result::Success) {
+        new (&value_) T(std::forward<U>(value));
+    }
+
+    //! Hold the error in @p unexpected.
+    Expected(Unexpected const& unexpected) noexcept : hasValue_(false), result_(unexpected.error()) {}
+
+    Expected(Expected const& other) : hasValue_(other.hasValue_), result_(other.result_) {
+        if (hasValue_) {
+            new (&value_) T(other.value_);
+        }
+    }
+
+    Expected(Expected&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : hasValue_(other.hasValue_), result_(other.result_) {
+        if (hasValue_) {
+            new (&value_) T(std::move(other.value_));
+        }
+    }
+
+    Expected& operator=(Expected const& other) {
+        if (this != &other) {
+            destroy();
+            // Empty until the new value is built, so that a throwing constructor does not leave a destroyed value
+            // behind for the destructor.
+            hasValue_ = false;
+            result_ = other.result_;
+            if (other.hasValue_) {
+                new (&value_) T(other.value_);
+                hasValue_ = true;
+            }
+        }
+        return *this;
+    }
+
+    Expected& operator=(Expected&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            destroy();
+            hasValue_ = false;
+            result_ = other.result_;
+            if (other.hasValue_) {
+                new (&value_) T(std::move(other.value_));
+                hasValue_ = true;
+            }
+        }
+        return *this;
+    }
+
+    ~Expected() { destroy(); }
+
+    //! True if this holds a value rather than an error.
+    bool has_value() const noexcept { return hasValue_; }
+    explicit operator bool() const noexcept { return hasValue_; }
+
+    //! The value. Asserts that there is one.
+    T& value() & noexcept {
+        OPENXR_HPP_ASSERT(hasValue_);
+        return value_;
+    }
+    T const& value() const& noexcept {
+        OPENXR_HPP_ASSERT(hasValue_);
+        return value_;
+    }
+    T&& value() && noexcept {
+        OPENXR_HPP_ASSERT(hasValue_);
+        return std::move(value_);
+    }
+
+    T& operator*() & noexcept { return value(); }
+    T const& operator*() const& noexcept { return value(); }
+    T&& operator*() && noexcept { return std::move(*this).value(); }
+    T* operator->() noexcept { return &value(); }
+    T const* operator->() const noexcept { return &value(); }
+
+    //! The value if there is one, otherwise @p defaultValue.
+    template <typename U>
+    T value_or(U&& defaultValue) const& {
+        return hasValue_ ? value_ : static_cast<T>(std::forward<U>(defaultValue));
+    }
+    template <typename U>
+    T value_or(U&& defaultValue) && {
+        return hasValue_ ? std::move(value_) : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+    //! The error, or Result::Success if there is a value.
+    Result error() const noexcept { return result_; }
+
+   private:
+    void destroy() noexcept {
+        if (hasValue_) {
+            value_.~T();
+        }
+    }
+
+    union {
+        T value_;
+    };
+    bool hasValue_;
+    Result result_;
+};
+#endif  // OPENXR_HPP_HAS_STD_EXPECTED
+
+namespace impl {
+//! Builds the error return of a call returning Expected. Out of line and cold, so that it stays off the success path.
+OPENXR_HPP_NOINLINE_COLD inline Unexpected makeUnexpected(Result result) noexcept { return Unexpected{result}; }
+}  // namespace impl
+
 }  // namespace OPENXR_HPP_NAMESPACE
@@ -64,12 +64,42 @@ OPENXR_HPP_INLINE OPENXR_HPP_CONSTEXPR /*{enum.name}*/ get(/*{projected_type}*/
     return static_cast</*{enum.name}*/>(v);
 }
 
+//# set name_table = enum_name_table(enum)
+//# if name_table
+namespace impl {
+template <typename Dummy>
+struct EnumNameTable</*{projected_type}*/, Dummy> {
+    static constexpr uint16_t seeds[/*{ name_table.seeds | length }*/] = {/*{ name_table.seeds | join(", ") }*/};
+    static constexpr EnumNameSlot slots[/*{ name_table.slots | length }*/] = {
+//#     for slot in name_table.slots
+//#         if slot
+        {/*{ slot[0] }*/u, /*{ slot[1] | quote_string }*/},
+//#         else
+        {0, nullptr},
+//#         endif
+//#     endfor
+    };
+};
+template <typename Dummy>
+constexpr uint16_t EnumNameTable</*{projected_type}*/, Dummy>::seeds[/*{ name_table.seeds | length }*/];
+template <typename Dummy>
+constexpr EnumNameSlot EnumNameTable</*{projected_type}*/, Dummy>::slots[/*{ name_table.slots | length }*/];
+}  // namespace impl
+
+//# endif
 //# filter block_doxygen_comment
 //! @brief Free function for retrieving the string name of a /*{projected_type}*/ value as a const char *.
 //!
 //! @found_by_adl
 //! @see /*{projected_type}*/
 //# endfilter
+//# if name_table
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const char* to_string_literal(/*{projected_type}*/ value) {
+    // Looked up in a perfect hash table rather than a switch, since the values are many and spread out.
+    return impl::lookupEnumName(impl::EnumNameTable</*{projected_type}*/>::seeds, impl::EnumNameTable</*{projected_type}*/>::slots,
+                                static_cast<uint32_t>(value));
+}
+//# else
 OPENXR_HPP_INLINE OPENXR_HPP_SWITCH_CONSTEXPR const char* to_string_literal(/*{projected_type}*/ value) {
     switch (value) {
 //# for val in enum.values
@@ -87,6 +117,7 @@ OPENXR_HPP_INLINE OPENXR_HPP_SWITCH_CONSTEXPR const char* to_string_literal(/*{p
             return "invalid";
     }
 }
+//# endif
 
 //# filter block_doxygen_comment
 //! @brief Free function for retrieving the string name of a /*{projected_type}*/ value as a std::string.
@@ -99,6 +130,60 @@ OPENXR_HPP_INLINE OPENXR_HPP_SWITCH_CONSTEXPR std::string to_string(/*{projected
 }
 //! @}
 
+//# set index_table = enum_index_table(enum)
+namespace impl {
+template <typename Dummy>
+struct EnumValueList</*{projected_type}*/, Dummy> {
+    static constexpr /*{projected_type}*/ values[] = {
+//# for run in index_table.runs
+        /*{ protect_begin(run[0], enum) }*/
+//#     for val in run
+        /*{projected_type -}*/ ::/*{- create_enum_value(val.name, enum.name) }*/,
+//#     endfor
+        /*{ protect_end(run[0], enum) }*/
+//# endfor
+    };
+    static constexpr size_t count = sizeof(values) / sizeof(values[0]);
+//# if index_table.dense
+    static constexpr size_t indexOf(/*{projected_type}*/ value) {
+        return denseEnumIndex(static_cast<uint32_t>(value) - /*{ index_table.first }*/u, count);
+    }
+};
+//# else
+    //! How many values of each run under the same guards are compiled in.
+    static constexpr size_t runSizes[] = {
+//#     for run in index_table.runs
+        /*{ protect_begin(run[0], enum) }*/
+        /*{ run | length }*/ +
+        /*{ protect_end(run[0], enum) }*/
+        0,
+//#     endfor
+    };
+    static constexpr uint16_t seeds[/*{ index_table.seeds | length }*/] = {/*{ index_table.seeds | join(", ") }*/};
+    static constexpr EnumIndexSlot slots[/*{ index_table.slots | length }*/] = {
+//#     for slot in index_table.slots
+//#         if slot
+        {/*{ slot[0] }*/u, enumIndexInRun(runSizes, /*{ slot[1] }*/, /*{ slot[2] }*/, count)},
+//#         else
+        {0, static_cast<uint32_t>(count)},
+//#         endif
+//#     endfor
+    };
+    static constexpr size_t indexOf(/*{projected_type}*/ value) {
+        return lookupEnumIndex(seeds, slots, static_cast<uint32_t>(value), count);
+    }
+};
+template <typename Dummy>
+constexpr size_t EnumValueList</*{projected_type}*/, Dummy>::runSizes[];
+template <typename Dummy>
+constexpr uint16_t EnumValueList</*{projected_type}*/, Dummy>::seeds[/*{ index_table.seeds | length }*/];
+template <typename Dummy>
+constexpr EnumIndexSlot EnumValueList</*{projected_type}*/, Dummy>::slots[/*{ index_table.slots | length }*/];
+//# endif
+template <typename Dummy>
+constexpr /*{projected_type}*/ EnumValueList</*{projected_type}*/, Dummy>::values[];
+}  // namespace impl
+
 //# if enum.name == "XrResult"
 /*!
  * @defgroup result_helpers Result helper free functions
@@ -59,6 +59,46 @@ enum class /*{projected_bits_type }*/ : XrFlags64 {
 //# endif
 };
 
+//# set bit_names = flag_bit_names(flags)
+namespace impl {
+template <typename Dummy>
+struct FlagBitNames</*{projected_bits_type}*/, Dummy> {
+    static constexpr const char* names[/*{ bit_names | length }*/] = {
+//# for name in bit_names
+        /*{ name | quote_string if name else 'nullptr' }*/,
+//# endfor
+    };
+};
+template <typename Dummy>
+constexpr const char* FlagBitNames</*{projected_bits_type}*/, Dummy>::names[/*{ bit_names | length }*/];
+}  // namespace impl
+
+//! @addtogroup utility_accessors
+//! @{
+//# filter block_doxygen_comment
+//! @brief Free function for retrieving the string name of a single /*{projected_bits_type}*/ bit as a const char *.
+//!
+//! Returns "None" for no bits, and "invalid" for more than one bit. Use to_string() to list the bits of a
+//! /*{projected_type}*/ value.
+//!
+//! @found_by_adl
+//! @see /*{projected_bits_type}*/
+//# endfilter
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const char* to_string_literal(/*{projected_bits_type}*/ value) noexcept {
+    return impl::flagBitName(impl::FlagBitNames</*{projected_bits_type}*/>::names, static_cast<uint64_t>(value));
+}
+
+//# filter block_doxygen_comment
+//! @brief Free function for retrieving the string name of a single /*{projected_bits_type}*/ bit as a std::string.
+//!
+//! @found_by_adl
+//! @see /*{projected_bits_type}*/
+//# endfilter
+OPENXR_HPP_INLINE std::string to_string(/*{projected_bits_type}*/ value) {
+    return {to_string_literal(value)};
+}
+//! @}
+
 //# filter block_doxygen_comment
 //! @brief Flags class projection of /*{flags.name}*/
 //!
@@ -73,7 +113,7 @@ using /*{projected_type }*/ = Flags</*{projected_bits_type }*/, /*{flags.name}*/
 //! @brief Bitwise OR operator between two /*{projected_bits_type }*/ flag bits.
 //! @see /*{projected_bits_type }*/, /*{projected_type }*/, xr::Flags
 //# endfilter
-OPENXR_HPP_INLINE /*{projected_type }*/ operator|( /*{projected_bits_type }*/ bit0, /*{projected_bits_type }*/ bit1) {
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE /*{projected_type }*/ operator|( /*{projected_bits_type }*/ bit0, /*{projected_bits_type }*/ bit1) noexcept {
     return /*{projected_type }*/( bit0 ) | bit1;
 }
 
@@ -81,7 +121,7 @@ OPENXR_HPP_INLINE /*{projected_type }*/ operator|( /*{projected_bits_type }*/ bi
 //! @brief Bitwise negation operator of a /*{projected_bits_type }*/ flag bit.
 //! @see /*{projected_bits_type }*/, /*{projected_type }*/, xr::Flags
 //# endfilter
-OPENXR_HPP_INLINE /*{projected_type }*/ operator~( /*{projected_bits_type }*/ bits) {
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE /*{projected_type }*/ operator~( /*{projected_bits_type }*/ bits) noexcept {
     return ~( /*{projected_type }*/( bits ) );
 }
 
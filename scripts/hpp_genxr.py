@@ -108,10 +108,14 @@ def genTarget(args):
         write('* options.emitExtensions    =', options.emitExtensions, file=sys.stderr)
 
     startTimer(args.time)
+    generatorArgs = {}
+    if args.enumNameSwitchMaxValues is not None:
+        generatorArgs['enum_name_switch_max_values'] = args.enumNameSwitchMaxValues
     gen = CppGenerator(errFile=errWarn,
                        warnFile=errWarn,
                        diagFile=diag,
-                       quiet=args.quiet)
+                       quiet=args.quiet,
+                       **generatorArgs)
     reg.setGenerator(gen)
     reg.apiGen(options)
 
@@ -170,6 +174,10 @@ if __name__ == '__main__':
                         help='Specify target')
     parser.add_argument('-quiet', action='store_true', default=False,
                         help='Suppress script output during normal execution.')
+    parser.add_argument('-enumNameSwitchMaxValues', action='store', type=int,
+                        default=None,
+                        help='Look up the names of enums with at most this many values in a switch, '
+                             'rather than a perfect hash table')
 
     args = parser.parse_args()
 
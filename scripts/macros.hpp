@@ -65,3 +65,30 @@ if (nullptr != /*{ src }*/) {
 #endif
 }
 //# endmacro
+
+//## Specializes impl::EnumValueTable for an enum or flag bits type, from a table built by enum_value_table() or
+//## flag_value_table().
+//# macro make_enum_value_table(projected_type, table)
+namespace impl {
+template <typename Dummy>
+struct EnumValueTable</*{projected_type}*/, Dummy> {
+    static constexpr uint32_t nameSeed = /*{ table.name_seed }*/u;
+    static constexpr uint16_t seeds[/*{ table.seeds | length }*/] = {/*{ table.seeds | join(", ") }*/};
+    static constexpr EnumValueSlot slots[/*{ table.slots | length }*/] = {
+//#     for slot in table.slots
+//#         if slot
+        {/*{ slot[0] | quote_string }*/, /*{ slot[0] | length }*/, /*{ slot[1] }*/},
+//#         else
+        {nullptr, 0, 0},
+//#         endif
+//#     endfor
+    };
+};
+template <typename Dummy>
+constexpr uint32_t EnumValueTable</*{projected_type}*/, Dummy>::nameSeed;
+template <typename Dummy>
+constexpr uint16_t EnumValueTable</*{projected_type}*/, Dummy>::seeds[/*{ table.seeds | length }*/];
+template <typename Dummy>
+constexpr EnumValueSlot EnumValueTable</*{projected_type}*/, Dummy>::slots[/*{ table.slots | length }*/];
+}  // namespace impl
+//# endmacro
@@ -45,20 +45,27 @@
 //# macro _describe_result(enhanced, exceptions_allowed)
 //#     filter replace("\n", " ")
 Result
-//#         if enhanced.multiple_success_codes or exceptions_allowed != true
+//#         if exceptions_allowed == "expected"
+(which may be /*{ enhanced.get_success_codes() | join(", ") }*/, or an error code)
+//#         elif enhanced.multiple_success_codes or exceptions_allowed != true
 (which may be /*{ enhanced.get_success_codes() | join(", ") }*/, or an error code if asserts are not active /*{ "and exceptions are disabled" if exceptions_allowed == "maybe" }*/)
 //#         endif
 //#     endfilter
 //# endmacro
 
 //# macro enhanced_method_behavior(enhanced, exceptions_allowed)
-//#     if not exceptions_allowed
+//#     if exceptions_allowed == "expected"
+// Returns the error in the Expected on failure, without asserting.
+//#     elif not exceptions_allowed
 // Asserts that the result is /*{ "one of the expected success codes." if enhanced.multiple_success_codes else "Result::Success." }*/
 //#     else
 // Throws an appropriate exception on failure /*%- if exceptions_allowed == "maybe" %*/ if `OPENXR_HPP_NO_EXCEPTIONS` is not defined/*% endif %*/.
 //#     endif
 //
-//# if enhanced.return_type.startswith("ResultValue")
+//# if enhanced.return_type.startswith("Expected")
+//#     set return_type = ""
+// @returns an Expected holding /*{ enhanced.prose_bare_return | trim }*/, or the error Result on failure
+//# elif enhanced.return_type.startswith("ResultValue")
 //#     set return_type = enhanced.bare_return_type
 //#     set ret_value_prefix = "\n// - "
 // @returns a ResultValue tuple containing:
@@ -88,7 +95,10 @@ Result
 //#     else
 //! @brief /*{cur_cmd.name}*/ enhanced wrapper/*% if hide_simple %*/ (hides basic wrapper unless `OPENXR_HPP_DISABLE_ENHANCED_MODE` defined)/*% endif %*/.
 //#     endif
-//#     if only_no_exceptions
+//#     if exceptions_allowed == "expected"
+//!
+//! Will not throw exceptions. This overload is only available when `OPENXR_HPP_EXPECTED` is defined.
+//#     elif only_no_exceptions
 //!
 //! Will not throw exceptions. This overload is only available when `OPENXR_HPP_NO_EXCEPTIONS` is defined.
 //#     elif exceptions_allowed == true
@@ -111,7 +121,7 @@ Result
 //# filter block_doxygen_comment
     /*{ enhanced_comment_intro(cur_cmd, exceptions_allowed, only_no_exceptions, hide_simple, brief, "Performs two-call idiom with a stateful allocator.") }*/
     //!
-    /*{ enhanced_method_behavior(enhanced) }*/
+    /*{ enhanced_method_behavior(enhanced, exceptions_allowed) }*/
     /*{ shared_comments(cur_cmd, enhanced) }*/
 //# endfilter
     template </*{ enhanced.get_template_decls(suppress_default_dispatch_arg=true) }*/>
@@ -149,7 +159,9 @@ template </*{ method.get_template_decls() }*/>
 //#     endif
 
 //#     if enhanced.explicit_result_elided
-#ifdef OPENXR_HPP_NO_EXCEPTIONS
+#if defined(OPENXR_HPP_EXPECTED)
+/*{ method_proto(cur_cmd, enhanced_cmds_expected[enhanced.name], "expected", true, hide_simple, "") }*/
+#elif defined(OPENXR_HPP_NO_EXCEPTIONS)
 /*{ method_proto(cur_cmd, enhanced_cmds_no_exceptions[enhanced.name], false, true, hide_simple, "") }*/
 # else
 /*{ method_proto(cur_cmd, enhanced, true, false, hide_simple, "") }*/
@@ -164,7 +176,9 @@ template </*{ method.get_template_decls() }*/>
 
 //#         set uniq = unique_cmds[cur_cmd.name]
 //#         if uniq.explicit_result_elided
-#ifdef OPENXR_HPP_NO_EXCEPTIONS
+#if defined(OPENXR_HPP_EXPECTED)
+/*{ method_proto(cur_cmd, unique_cmds_expected[uniq.name], "expected", true, false, "returning a smart handle.") }*/
+#elif defined(OPENXR_HPP_NO_EXCEPTIONS)
 /*{ method_proto(cur_cmd, unique_cmds_no_exceptions[uniq.name], false, true, false, "returning a smart handle.") }*/
 #else
 /*{ method_proto(cur_cmd, uniq, true, false, false, "returning a smart handle.") }*/
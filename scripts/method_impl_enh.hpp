@@ -41,17 +41,17 @@
 //# endif
 
 //#     if only_no_exceptions
-#ifdef OPENXR_HPP_NO_EXCEPTIONS
+#if defined(OPENXR_HPP_NO_EXCEPTIONS) && !defined(OPENXR_HPP_EXPECTED)
 //#     endif
 
 //#     if enhanced.is_two_call
-/*{ make_two_call(enhanced) }*/
+/*{ make_two_call(enhanced, exceptions_allowed) }*/
 //#     else
 /*{ make_enhanced(enhanced, exceptions_allowed) }*/
 //#     endif
 
 //# if only_no_exceptions and not enhanced.is_create
-#endif // OPENXR_HPP_NO_EXCEPTIONS
+#endif  // defined(OPENXR_HPP_NO_EXCEPTIONS) && !defined(OPENXR_HPP_EXPECTED)
 //# endif
 
 //# if enhanced.is_create
@@ -66,9 +66,9 @@
 //#     endif
 
 //#     if only_no_exceptions and not uniq_only_no_exceptions
-#endif // OPENXR_HPP_NO_EXCEPTIONS
+#endif  // defined(OPENXR_HPP_NO_EXCEPTIONS) && !defined(OPENXR_HPP_EXPECTED)
 //#     elif uniq_only_no_exceptions and not only_no_exceptions
-#ifdef OPENXR_HPP_NO_EXCEPTIONS
+#if defined(OPENXR_HPP_NO_EXCEPTIONS) && !defined(OPENXR_HPP_EXPECTED)
 //#     endif
 
 
@@ -87,5 +87,5 @@
 
 //# endif
 //# if uniq_only_no_exceptions
-#endif  // OPENXR_HPP_NO_EXCEPTIONS
+#endif  // defined(OPENXR_HPP_NO_EXCEPTIONS) && !defined(OPENXR_HPP_EXPECTED)
 //# endif
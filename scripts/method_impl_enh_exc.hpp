@@ -35,7 +35,7 @@
 
 //# if enhanced.explicit_result_elided
 //#     if enhanced.is_two_call
-/*{ make_two_call(enhanced) }*/
+/*{ make_two_call(enhanced, exceptions_allowed) }*/
 //#     else
 /*{ make_enhanced(enhanced, exceptions_allowed) }*/
 //#     endif
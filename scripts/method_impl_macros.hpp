@@ -62,6 +62,7 @@
 //# endmacro
 
 //# macro make_two_call(enhanced, exceptions_allowed)
+/*{ make_throw_thunk(enhanced, exceptions_allowed) }*/
 template </*{ enhanced.template_defns }*/>
 OPENXR_HPP_INLINE /*{enhanced.return_type}*/ /*{enhanced.qualified_name}*/ (
     /*{ enhanced.get_definition_params() | join(", ")}*/) /*{enhanced.qualifiers}*/ {
@@ -84,25 +85,51 @@ OPENXR_HPP_INLINE /*{enhanced.return_type}*/ /*{enhanced.qualified_name}*/ (
     OPENXR_HPP_ASSERT( /*{_make_success_predicate(method)}*/ );
 //# endmacro
 
+/*% macro _make_throw_thunk_name(method) -%*/ impl::throwResultFor_/*{ method.qualified_name | replace("::", "_") }*/ /*%- endmacro %*/
+
+//## Each throwing wrapper hands its failures to a thunk of its own, so that the wrapper itself only carries a
+//## predicted-not-taken branch and a call, while the message and the throw live out of line in cold code.
+//# macro _make_throw_thunk_body(method)
+namespace impl {
+[[noreturn]] OPENXR_HPP_NOINLINE_COLD inline void throwResultFor_/*{ method.qualified_name | replace("::", "_") }*/(Result result) {
+    exceptions::throwResultException(result, OPENXR_HPP_NAMESPACE_STRING "::/*{method.qualified_name}*/", CommandId::/*{ method.name[2:] }*/);
+}
+}  // namespace impl
+//# endmacro
+
+//# macro make_throw_thunk(method, exceptions_allowed)
+//#     if exceptions_allowed == "maybe"
+#ifndef OPENXR_HPP_NO_EXCEPTIONS
+/*{ _make_throw_thunk_body(method) }*/
+#endif  // !OPENXR_HPP_NO_EXCEPTIONS
+//#     elif exceptions_allowed and exceptions_allowed != "expected"
+/*{ _make_throw_thunk_body(method) }*/
+//#     endif
+//# endmacro
+
 //# macro _make_error_handling_exceptions(method)
-    if (!(/*{_make_success_predicate(method)}*/)) {
-        exceptions::throwResultException(/*{method.result_name}*/, OPENXR_HPP_NAMESPACE_STRING "::/*{method.qualified_name}*/");
+    if (OPENXR_HPP_UNLIKELY(!(/*{_make_success_predicate(method)}*/))) {
+        /*{ _make_throw_thunk_name(method) }*/(/*{method.result_name}*/);
     }
 //# endmacro
 
 //# macro _make_error_handling_maybe_exceptions(method)
-#ifdef OPENXR_HPP_NO_EXCEPTIONS
+#if defined(OPENXR_HPP_EXPECTED)
+    // The caller checks the returned Result.
+#elif defined(OPENXR_HPP_NO_EXCEPTIONS)
     OPENXR_HPP_ASSERT( /*{_make_success_predicate(method)}*/ );
 #else
-    if (!(/*{_make_success_predicate(method)}*/)) {
-        exceptions::throwResultException(/*{method.result_name}*/, OPENXR_HPP_NAMESPACE_STRING "::/*{method.qualified_name}*/");
+    if (OPENXR_HPP_UNLIKELY(!(/*{_make_success_predicate(method)}*/))) {
+        /*{ _make_throw_thunk_name(method) }*/(/*{method.result_name}*/);
     }
 #endif
 
 //# endmacro
 
 //# macro make_error_handling(enhanced, exceptions_allowed)
-//#     if exceptions_allowed == "maybe"
+//#     if exceptions_allowed == "expected"
+//## The return statement hands errors back in the Expected.
+//#     elif exceptions_allowed == "maybe"
     /*{ _make_error_handling_maybe_exceptions(enhanced) }*/
 //#     elif exceptions_allowed
     /*{ _make_error_handling_exceptions(enhanced) }*/
@@ -112,6 +139,7 @@ OPENXR_HPP_INLINE /*{enhanced.return_type}*/ /*{enhanced.qualified_name}*/ (
 //# endmacro
 
 //# macro make_enhanced(enhanced, exceptions_allowed)
+/*{ make_throw_thunk(enhanced, exceptions_allowed) }*/
 
 template </*{ enhanced.template_defns }*/>
 OPENXR_HPP_INLINE /*{enhanced.return_type}*/ /*{enhanced.qualified_name}*/ (
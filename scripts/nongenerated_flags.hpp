@@ -30,101 +30,213 @@
 //## but only in their entirety and only with respect to the Combined Software.
 
 
+
 namespace OPENXR_HPP_NAMESPACE {
 
+//! Implementation details
+namespace impl {
+#if defined(__GNUC__) || defined(__clang__)
+//! Number of set bits.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t popCount(uint64_t x) noexcept { return static_cast<uint32_t>(__builtin_popcountll(x)); }
+
+//! Index of the lowest set bit, or 64 if there is none.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t countTrailingZeros(uint64_t x) noexcept {
+    return x == 0 ? 64 : static_cast<uint32_t>(__builtin_ctzll(x));
+}
+#elif defined(OPENXR_HPP_HAS_BITOPS)
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t popCount(uint64_t x) noexcept { return static_cast<uint32_t>(std::popcount(x)); }
+
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t countTrailingZeros(uint64_t x) noexcept {
+    return static_cast<uint32_t>(std::countr_zero(x));
+}
+#else
+// Such as MSVC before C++20: counted in parallel across the word ("SWAR"), a dozen branch-free operations that are
+// also constexpr in C++11. __popcnt64 is left alone, since it faults on CPUs without the POPCNT instruction.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint64_t popCountNibbles(uint64_t pairs) noexcept {
+    return (pairs & 0x3333333333333333u) + ((pairs >> 2) & 0x3333333333333333u);
+}
+
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t popCountBytes(uint64_t nibbles) noexcept {
+    return static_cast<uint32_t>((((nibbles + (nibbles >> 4)) & 0x0F0F0F0F0F0F0F0Fu) * 0x0101010101010101u) >> 56);
+}
+
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t popCount(uint64_t x) noexcept {
+    return popCountBytes(popCountNibbles(x - ((x >> 1) & 0x5555555555555555u)));
+}
+
+//! The bits below the lowest set bit, counted.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t countTrailingZeros(uint64_t x) noexcept {
+    return x == 0 ? 64 : popCount((x & (~x + 1)) - 1);
+}
+#endif
+
+//! Names of the bits of a flag bits type, as a static `names` array indexed by bit position, with null entries for
+//! positions that are not bits of the type. Specialized for each flag bits type.
+template <typename BitType, typename Dummy = void>
+struct FlagBitNames;
+
+template <size_t N>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const char* flagBitNameAt(const char* const (&names)[N], uint32_t position) noexcept {
+    return position < N && names[position] != nullptr ? names[position] : "invalid";
+}
+
+//! The name of a single bit in a FlagBitNames table: "None" for no bits, and "invalid" for anything but a known bit.
+template <size_t N>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const char* flagBitName(const char* const (&names)[N], uint64_t bit) noexcept {
+    return bit == 0 ? "None" : (bit & (bit - 1)) != 0 ? "invalid" : flagBitNameAt(names, countTrailingZeros(bit));
+}
+}  // namespace impl
+
 /**
  * @brief Template type for bit flag projection
  *
+ * Usable in constant expressions. Iterating over a Flags value visits each set bit, from the lowest, as a single
+ * BitType value:
+ *
+ * @code
+ * for (xr::SwapchainUsageFlagBits bit : usageFlags) { ... }
+ * @endcode
+ *
  * @tparam BitType The projected enum that contains the bits
  * @tparam MaskType The type of the combined flags, typically the default, XrFlags64.
  */
 template <typename BitType, typename MaskType = XrFlags64>
 class Flags {
    public:
+    //! Iterator over the set bits of a Flags value, which yields each as a single BitType value.
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = BitType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const BitType *;
+        using reference = BitType;
+
+        //! Constructs an end iterator.
+        OPENXR_HPP_CONSTEXPR const_iterator() noexcept : m_remaining(0) {}
+
+        //! Constructs an iterator over the set bits of @p remaining.
+        OPENXR_HPP_CONSTEXPR explicit const_iterator(MaskType remaining) noexcept : m_remaining(remaining) {}
+
+        //! The lowest remaining set bit, isolated with two's complement rather than a loop.
+        OPENXR_HPP_CONSTEXPR BitType operator*() const noexcept { return static_cast<BitType>(m_remaining & (~m_remaining + 1)); }
+
+        //! Clears the lowest remaining set bit.
+        OPENXR_HPP_CONSTEXPR_14 const_iterator &operator++() noexcept {
+            m_remaining &= m_remaining - 1;
+            return *this;
+        }
+
+        OPENXR_HPP_CONSTEXPR_14 const_iterator operator++(int) noexcept {
+            const_iterator result(*this);
+            ++*this;
+            return result;
+        }
+
+        OPENXR_HPP_CONSTEXPR bool operator==(const_iterator const &rhs) const noexcept { return m_remaining == rhs.m_remaining; }
+
+        OPENXR_HPP_CONSTEXPR bool operator!=(const_iterator const &rhs) const noexcept { return m_remaining != rhs.m_remaining; }
+
+       private:
+        MaskType m_remaining;
+    };
+    using iterator = const_iterator;
+
     //! Default constructor
-    OPENXR_HPP_CONSTEXPR Flags() : m_mask(0) {}
+    OPENXR_HPP_CONSTEXPR Flags() noexcept : m_mask(0) {}
 
     //! Implicit constructor from a single bit
-    Flags(BitType bit) : m_mask(static_cast<MaskType>(bit)) {}
+    OPENXR_HPP_CONSTEXPR Flags(BitType bit) noexcept : m_mask(static_cast<MaskType>(bit)) {}
 
     //! Copy constructor
-    Flags(Flags const &rhs) = default;
+    Flags(Flags const &rhs) noexcept = default;
 
     //! Copy assignment
-    Flags &operator=(Flags const &rhs) = default;
+    Flags &operator=(Flags const &rhs) noexcept = default;
 
     //! Explicit constructor from flags value
-    explicit Flags(MaskType flags) : m_mask(flags) {}
+    OPENXR_HPP_CONSTEXPR explicit Flags(MaskType flags) noexcept : m_mask(flags) {}
 
     //! OR update operator - commonly used for combining flags
-    Flags &operator|=(Flags const &rhs) {
+    OPENXR_HPP_CONSTEXPR_14 Flags &operator|=(Flags const &rhs) noexcept {
         m_mask |= rhs.m_mask;
         return *this;
     }
 
     //! AND update operator
-    Flags &operator&=(Flags const &rhs) {
+    OPENXR_HPP_CONSTEXPR_14 Flags &operator&=(Flags const &rhs) noexcept {
         m_mask &= rhs.m_mask;
         return *this;
     }
 
     //! XOR update operator
-    Flags &operator^=(Flags const &rhs) {
+    OPENXR_HPP_CONSTEXPR_14 Flags &operator^=(Flags const &rhs) noexcept {
         m_mask ^= rhs.m_mask;
         return *this;
     }
 
     //! OR operator, often used for combining flags.
-    Flags operator|(Flags const &rhs) const {
-        Flags result(*this);
-        result |= rhs;
-        return result;
-    }
+    OPENXR_HPP_CONSTEXPR Flags operator|(Flags const &rhs) const noexcept { return Flags(m_mask | rhs.m_mask); }
 
     //! AND operator, often used for testing the value of certain bits.
-    Flags operator&(Flags const &rhs) const {
-        Flags result(*this);
-        result &= rhs;
-        return result;
-    }
+    OPENXR_HPP_CONSTEXPR Flags operator&(Flags const &rhs) const noexcept { return Flags(m_mask & rhs.m_mask); }
 
     //! XOR operator
-    Flags operator^(Flags const &rhs) const {
-        Flags result(*this);
-        result ^= rhs;
-        return result;
-    }
+    OPENXR_HPP_CONSTEXPR Flags operator^(Flags const &rhs) const noexcept { return Flags(m_mask ^ rhs.m_mask); }
 
     //! Unary negation: true if all bits were false.
-    bool operator!() const { return !m_mask; }
+    OPENXR_HPP_CONSTEXPR bool operator!() const noexcept { return !m_mask; }
 
     //! Bitwise negation (complement) operator
-    Flags operator~() const {
-        Flags result(*this);
-        result.m_mask ^= static_cast<MaskType>(BitType::AllBits);
-        return result;
-    }
+    OPENXR_HPP_CONSTEXPR Flags operator~() const noexcept { return Flags(m_mask ^ static_cast<MaskType>(BitType::AllBits)); }
 
     //! Accessor for contained value
-    MaskType get() const noexcept { return m_mask; }
+    OPENXR_HPP_CONSTEXPR MaskType get() const noexcept { return m_mask; }
+
+    //! True if any bit is set.
+    OPENXR_HPP_CONSTEXPR bool any() const noexcept { return m_mask != 0; }
+
+    //! True if any bit of @p mask is set.
+    OPENXR_HPP_CONSTEXPR bool any(Flags const &mask) const noexcept { return (m_mask & mask.m_mask) != 0; }
+
+    //! True if every bit of the type is set.
+    OPENXR_HPP_CONSTEXPR bool all() const noexcept { return all(Flags(static_cast<MaskType>(BitType::AllBits))); }
+
+    //! True if every bit of @p mask is set, as when checking that a location is both position- and orientation-valid.
+    OPENXR_HPP_CONSTEXPR bool all(Flags const &mask) const noexcept { return (m_mask & mask.m_mask) == mask.m_mask; }
+
+    //! True if no bit is set.
+    OPENXR_HPP_CONSTEXPR bool none() const noexcept { return m_mask == 0; }
+
+    //! True if no bit of @p mask is set.
+    OPENXR_HPP_CONSTEXPR bool none(Flags const &mask) const noexcept { return (m_mask & mask.m_mask) == 0; }
+
+    //! Number of set bits.
+    OPENXR_HPP_CONSTEXPR uint32_t count() const noexcept { return impl::popCount(static_cast<uint64_t>(m_mask)); }
+
+    //! Iterator to the lowest set bit.
+    OPENXR_HPP_CONSTEXPR const_iterator begin() const noexcept { return const_iterator(m_mask); }
+
+    //! Iterator past the highest set bit.
+    OPENXR_HPP_CONSTEXPR const_iterator end() const noexcept { return const_iterator(); }
 
     //! Equality comparison
-    bool operator==(Flags const &rhs) const { return m_mask == rhs.m_mask; }
+    OPENXR_HPP_CONSTEXPR bool operator==(Flags const &rhs) const noexcept { return m_mask == rhs.m_mask; }
 
     //! Inequality comparison
-    bool operator!=(Flags const &rhs) const { return m_mask != rhs.m_mask; }
+    OPENXR_HPP_CONSTEXPR bool operator!=(Flags const &rhs) const noexcept { return m_mask != rhs.m_mask; }
 
     //! Equality comparison, mainly intended for compare to 0
-    bool operator==(int rhs) const { return m_mask == static_cast<MaskType>(rhs); }
+    OPENXR_HPP_CONSTEXPR bool operator==(int rhs) const noexcept { return m_mask == static_cast<MaskType>(rhs); }
 
     //! Inequality comparison, mainly intended for compare to 0
-    bool operator!=(int rhs) const { return m_mask != static_cast<MaskType>(rhs); }
+    OPENXR_HPP_CONSTEXPR bool operator!=(int rhs) const noexcept { return m_mask != static_cast<MaskType>(rhs); }
 
     //! Explicit bool conversion: true if any bits are true.
-    explicit operator bool() const { return !!m_mask; }
+    OPENXR_HPP_CONSTEXPR explicit operator bool() const noexcept { return !!m_mask; }
 
     //! Explicit conversion operator to the underlying mask type.
-    explicit operator MaskType() const { return m_mask; }
+    OPENXR_HPP_CONSTEXPR explicit operator MaskType() const noexcept { return m_mask; }
 
    private:
     MaskType m_mask;
@@ -141,7 +253,7 @@ class Flags {
  * @relates Flags
  */
 template <typename BitType, typename MaskType>
-Flags<BitType, MaskType> operator|(BitType bit, Flags<BitType, MaskType> const &flags) {
+OPENXR_HPP_CONSTEXPR Flags<BitType, MaskType> operator|(BitType bit, Flags<BitType, MaskType> const &flags) noexcept {
     return flags | bit;
 }
 
@@ -156,7 +268,7 @@ Flags<BitType, MaskType> operator|(BitType bit, Flags<BitType, MaskType> const &
  * @relates Flags
  */
 template <typename BitType, typename MaskType>
-Flags<BitType, MaskType> operator&(BitType bit, Flags<BitType, MaskType> const &flags) {
+OPENXR_HPP_CONSTEXPR Flags<BitType, MaskType> operator&(BitType bit, Flags<BitType, MaskType> const &flags) noexcept {
     return flags & bit;
 }
 
@@ -171,8 +283,30 @@ Flags<BitType, MaskType> operator&(BitType bit, Flags<BitType, MaskType> const &
  * @relates Flags
  */
 template <typename BitType, typename MaskType>
-Flags<BitType, MaskType> operator^(BitType bit, Flags<BitType, MaskType> const &flags) {
+OPENXR_HPP_CONSTEXPR Flags<BitType, MaskType> operator^(BitType bit, Flags<BitType, MaskType> const &flags) noexcept {
     return flags ^ bit;
 }
 
+/**
+ * @brief The names of the set bits of a Flags<> value, separated by " | ", or "None" if there are none.
+ *
+ * Bits that are not bits of the type are named "invalid", as by to_string_literal().
+ *
+ * @relates Flags
+ */
+template <typename BitType, typename MaskType>
+OPENXR_HPP_INLINE std::string to_string(Flags<BitType, MaskType> const &flags) {
+    if (!flags) {
+        return "None";
+    }
+    std::string result;
+    for (BitType bit : flags) {
+        if (!result.empty()) {
+            result += " | ";
+        }
+        result += to_string_literal(bit);
+    }
+    return result;
+}
+
 }  // namespace OPENXR_HPP_NAMESPACE
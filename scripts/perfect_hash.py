@@ -0,0 +1,136 @@
+#!/usr/bin/python3 -i
+#
+# Copyright (c) 2019 The Khronos Group Inc.
+# Copyright (c) 2019 Collabora, Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Builds minimal-probe perfect hash tables over 32-bit keys, for lookup tables in the generated headers.
+
+Strings are first reduced to 32-bit keys with name_hash(), which works on eight bytes at a time. build_name_table()
+picks a seed for name_hash() under which the names of a table all get different keys.
+
+A key's bucket is picked by hash(key, 0), and each bucket has a seed chosen so that hash(key, seed) puts every key
+of every bucket in a slot of its own ("hash and displace"). A lookup is thus two hashes and two loads.
+
+The hashes must match impl::perfectHash() in template_openxr_enums.hpp and impl::nameHash() in
+template_openxr_enum_parse.hpp.
+"""
+
+_MASK = 0xFFFFFFFF
+_MULTIPLIER = 0x9E3779B1
+_MAX_SEED = 1 << 16
+_WORD_MASK = 0xFFFFFFFFFFFFFFFF
+_WORD_MULTIPLIER = 0x9E3779B97F4A7C15
+
+
+def perfect_hash(key, seed):
+    """Mix a 32-bit key with a seed. Mirrors impl::perfectHash()."""
+    x = ((key ^ seed) * _MULTIPLIER) & _MASK
+    return x ^ (x >> 16)
+
+
+def _mix_word(h, word):
+    x = ((h ^ word) * _WORD_MULTIPLIER) & _WORD_MASK
+    return x ^ (x >> 32)
+
+
+def name_hash(string, seed=0):
+    """Hash a string's UTF-8 bytes to a 32-bit key. Mirrors impl::nameHash().
+
+    The bytes are read as little-endian 64-bit words, starting from the length, with the seed in the upper half. The
+    last word is the last eight bytes, overlapping the one before if need be, or the whole string zero-padded if
+    shorter than that.
+    """
+    data = string.encode('utf-8')
+    h = len(data) ^ (seed << 32)
+    if len(data) < 8:
+        return _mix_word(h, int.from_bytes(data, 'little')) & _MASK
+    i = 0
+    while len(data) - i > 8:
+        h = _mix_word(h, int.from_bytes(data[i:i + 8], 'little'))
+        i += 8
+    return _mix_word(h, int.from_bytes(data[-8:], 'little')) & _MASK
+
+
+def _next_pow2(n):
+    size = 1
+    while size < n:
+        size *= 2
+    return size
+
+
+class PerfectHashTable:
+    """The seeds and slots of a perfect hash table.
+
+    seeds has a power-of-two length, indexed by perfect_hash(key, 0).
+    slots has a power-of-two length; each is the index of the key placed there, or None.
+    """
+
+    def __init__(self, seeds, slots):
+        self.seeds = seeds
+        self.slots = slots
+
+    def find(self, key):
+        seed = self.seeds[perfect_hash(key, 0) & (len(self.seeds) - 1)]
+        return self.slots[perfect_hash(key, seed) & (len(self.slots) - 1)]
+
+
+def _try_build(keys, slot_count, bucket_count):
+    buckets = [[] for _ in range(bucket_count)]
+    for i, key in enumerate(keys):
+        buckets[perfect_hash(key, 0) & (bucket_count - 1)].append(i)
+
+    seeds = [0] * bucket_count
+    slots = [None] * slot_count
+    # Place the fullest buckets first, while there is the most room.
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        members = buckets[bucket]
+        if not members:
+            break
+        for seed in range(1, _MAX_SEED):
+            placed = [perfect_hash(keys[i], seed) & (slot_count - 1) for i in members]
+            if len(set(placed)) == len(placed) and all(slots[s] is None for s in placed):
+                for i, s in zip(members, placed):
+                    slots[s] = i
+                seeds[bucket] = seed
+                break
+        else:
+            return None
+    return PerfectHashTable(seeds, slots)
+
+
+def build_perfect_hash(keys):
+    """Build a PerfectHashTable for a list of distinct 32-bit keys."""
+    assert len(set(keys)) == len(keys), "perfect hash keys must be distinct"
+    slot_count = _next_pow2(len(keys))
+    while True:
+        table = _try_build(keys, slot_count, max(1, slot_count // 4))
+        if table is not None:
+            return table
+        slot_count *= 2
+
+
+def build_name_table(names):
+    """Build a PerfectHashTable for a list of distinct strings, keyed by name_hash().
+
+    Tries name_hash() seeds in turn until no two names have the same key. The seed used is the table's name_seed.
+    """
+    assert len(set(names)) == len(names), "perfect hash names must be distinct"
+    for name_seed in range(_MAX_SEED):
+        keys = [name_hash(name, name_seed) for name in names]
+        if len(set(keys)) == len(keys):
+            table = build_perfect_hash(keys)
+            table.name_seed = name_seed
+            return table
+    raise RuntimeError("no name hash seed tells the names apart")
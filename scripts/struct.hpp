@@ -32,7 +32,7 @@
 //# from 'macros.hpp' import wrapperSizeStaticAssert, initializeStaticLengthString, make_spec_ref, extension_comment
 
 //# macro _makeDefaultConstructor(s, is_explicit, visible_members)
-        /*{ "explicit" if is_explicit }*/ /*{s.cpp_name }*/ (
+        OPENXR_HPP_CONSTEXPR /*{ "explicit" if is_explicit }*/ /*{s.cpp_name }*/ (
 
             /*{s.next_param_decl_with_default if s.typed_struct}*/) /*{ ":" if visible_members or s.typed_struct }*/
 //#     set arg_comma = joiner(", ")
@@ -44,14 +44,18 @@
 //#         endif
              , /*{s.next_param_name}*/)
 //#     endif
-//#    for member in visible_members if member.name not in s.parent_fields and not is_static_length_string(member)
+//#    for member in visible_members if member.name not in s.parent_fields
+//#        if is_static_length_string(member)
+                  /*{- arg_comma() }*/ /*{ member.name }*/{}
+//#        else
                   /*{- arg_comma() }*/ /*{ member.name }*/{/*{ get_default_for_member(member, s.name, "") -}*/}
+//#        endif
 //#    endfor
             {}
 //# endmacro
 
 //# macro _makeFullInitializingConstructor(struct, s, visible_members, allowDefaulting)
-        /*{ s.cpp_name }*/ (
+        /*{ "OPENXR_HPP_CONSTEXPR" if s.full_constructor_is_constexpr }*/ /*{ s.cpp_name }*/ (
 //#    set first_defaultable_index0 = index0_of_first_visible_defaultable_member(visible_members)
 //#    set arg_comma = joiner(", ")
                   /*%- if s.is_abstract %*/ /*{ arg_comma() }*/ StructureType type_ /*% endif -%*/
@@ -117,13 +121,12 @@
 //# else
     public:
 //# endif
+//# set visible_members = struct.members | reject('cpp_hidden_member') | list
 //# if struct is struct_output and not s.is_abstract
         //! Empty constructor for a type that is marked as "returnonly"
-        /*{ _makeDefaultConstructor(s) }*/
+        /*{ _makeDefaultConstructor(s, false, visible_members) }*/
 //# else
 
-//#     set visible_members = struct.members | reject('cpp_hidden_member') | list
-
 //#     if visible_members | count > 0 or s.is_abstract
 //#         if s.is_abstract
         //! Protected constructor: this type is abstract.
@@ -148,15 +151,11 @@
         /*{ s.cpp_name }*/(const /*{ s.cpp_name }*/& rhs) = default;
         //! Default copy assignment
         /*{ s.cpp_name }*/& operator=(const /*{ s.cpp_name }*/& rhs) = default;
-        //! Copy construct from raw
-        /*{ s.cpp_name }*/(const /*{ s.name }*/& rhs) : /*{ s.cpp_name }*/() {
-            *put() = rhs;
-        }
-        //! Copy assign from raw
-        /*{ s.cpp_name }*/& operator=(const /*{ s.name }*/& rhs) {
-            if ((const void*) this == (const void *)&rhs) return *this;
-            *put() = rhs;
-            return *this;
+        //! Copy construct from raw: a single trivial copy, since the layouts are identical.
+        /*{ s.cpp_name }*/(const /*{ s.name }*/& rhs) noexcept : /*{ s.cpp_name }*/(reinterpret_cast<const /*{ s.cpp_name }*/&>(rhs)) {}
+        //! Copy assign from raw: a single trivial copy, since the layouts are identical.
+        /*{ s.cpp_name }*/& operator=(const /*{ s.name }*/& rhs) noexcept {
+            return *this = reinterpret_cast<const /*{ s.cpp_name }*/&>(rhs);
         }
 //# endif
 
@@ -204,6 +203,7 @@
 //# endfor
     };
     /*{ wrapperSizeStaticAssert(struct.name, s.cpp_name) }*/
+    static_assert(std::is_trivially_copyable</*{ s.cpp_name }*/>::value, "Wrapper must be trivially copyable like the original type!");
 
 //# filter block_doxygen_comment
     //! @brief Free function for getting a raw /*{struct.name}*/ pointer to const from a /*{s.cpp_name}*/ reference to const.
@@ -0,0 +1,409 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a compile-time action manifest and a function to create its action set, actions and bindings.
+ *
+ * @see xr::ActionManifest, xr::createActionManifest
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief One action in an ActionManifest.
+ *
+ * @ingroup utilities
+ */
+struct ManifestAction {
+    //! Action name: lowercase letters, digits, `-`, `_` and `.` only.
+    const char* name;
+    //! Human-readable name, unique within the manifest.
+    const char* localizedName;
+    //! Type of the action.
+    ActionType type;
+    //! Bit `i` set if the action uses subaction path `i` of the manifest.
+    uint32_t subactionPathMask;
+};
+
+/*!
+ * @brief One suggested binding in an ActionManifest.
+ *
+ * @ingroup utilities
+ */
+struct ManifestBinding {
+    //! Interaction profile path, such as `/interaction_profiles/khr/simple_controller`.
+    const char* interactionProfile;
+    //! Index of the bound action in the manifest.
+    uint32_t action;
+    //! Binding path, such as `/user/hand/left/input/select/click`.
+    const char* path;
+};
+
+namespace impl {
+namespace manifest {
+// Plain inline: these recurse, so they cannot be forced inline.
+OPENXR_HPP_CONSTEXPR inline bool isNameChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.';
+}
+
+// Non-empty, made of isNameChar() characters, and shorter than maxSize including the terminator.
+OPENXR_HPP_CONSTEXPR inline bool isValidName(const char* s, size_t maxSize, size_t i = 0) {
+    return s != nullptr && (s[i] == '\0' ? i > 0 : (i + 1 < maxSize && isNameChar(s[i]) && isValidName(s, maxSize, i + 1)));
+}
+
+OPENXR_HPP_CONSTEXPR inline bool isValidLocalizedName(const char* s, size_t maxSize, size_t i = 0) {
+    return s != nullptr && (s[i] == '\0' ? i > 0 : (i + 1 < maxSize && isValidLocalizedName(s, maxSize, i + 1)));
+}
+
+OPENXR_HPP_CONSTEXPR inline bool startsWith(const char* s, const char* prefix) {
+    return *prefix == '\0' || (*s == *prefix && startsWith(s + 1, prefix + 1));
+}
+
+OPENXR_HPP_CONSTEXPR inline bool equal(const char* a, const char* b) {
+    return *a == *b && (*a == '\0' || equal(a + 1, b + 1));
+}
+
+OPENXR_HPP_CONSTEXPR inline uint32_t lowBits(size_t count) { return count >= 32 ? ~uint32_t(0) : (uint32_t(1) << count) - 1; }
+}  // namespace manifest
+}  // namespace impl
+
+/*!
+ * @brief A compile-time description of an action set: its actions, subaction paths, and suggested bindings.
+ *
+ * The manifest refers to arrays with static storage duration, so it can be `constexpr`.
+ * Check it with `static_assert(manifest.isValid(), ...)`,
+ * and look up action indices at compile time with actionIndex(). Create the described objects at runtime with
+ * createActionManifest().
+ *
+ * @code
+ * constexpr const char* kHands[] = {"/user/hand/left", "/user/hand/right"};
+ * constexpr xr::ManifestAction kActions[] = {
+ *     {"grab", "Grab", xr::ActionType::BooleanInput, 0x3},
+ *     {"hand-pose", "Hand Pose", xr::ActionType::PoseInput, 0x3},
+ * };
+ * constexpr xr::ManifestBinding kBindings[] = {
+ *     {"/interaction_profiles/khr/simple_controller", 0, "/user/hand/left/input/select/click"},
+ *     {"/interaction_profiles/khr/simple_controller", 1, "/user/hand/left/input/grip/pose"},
+ * };
+ * constexpr xr::ActionManifest kManifest{"gameplay", "Gameplay", 0, kActions, kHands, kBindings};
+ * static_assert(kManifest.isValid(), "Invalid action manifest");
+ * constexpr uint32_t kGrab = kManifest.actionIndex("grab");
+ * @endcode
+ *
+ * @ingroup utilities
+ */
+class ActionManifest {
+   public:
+    //! Manifest with subaction paths.
+    template <size_t ActionCount, size_t SubactionPathCount, size_t BindingCount>
+    OPENXR_HPP_CONSTEXPR ActionManifest(const char* name, const char* localizedName, uint32_t priority,
+                                        ManifestAction const (&actions)[ActionCount],
+                                        const char* const (&subactionPaths)[SubactionPathCount],
+                                        ManifestBinding const (&bindings)[BindingCount]) noexcept
+        : name_(name),
+          localizedName_(localizedName),
+          priority_(priority),
+          actions_(actions),
+          actionCount_(ActionCount),
+          subactionPaths_(subactionPaths),
+          subactionPathCount_(SubactionPathCount),
+          bindings_(bindings),
+          bindingCount_(BindingCount) {}
+
+    //! Manifest without subaction paths.
+    template <size_t ActionCount, size_t BindingCount>
+    OPENXR_HPP_CONSTEXPR ActionManifest(const char* name, const char* localizedName, uint32_t priority,
+                                        ManifestAction const (&actions)[ActionCount],
+                                        ManifestBinding const (&bindings)[BindingCount]) noexcept
+        : name_(name),
+          localizedName_(localizedName),
+          priority_(priority),
+          actions_(actions),
+          actionCount_(ActionCount),
+          subactionPaths_(nullptr),
+          subactionPathCount_(0),
+          bindings_(bindings),
+          bindingCount_(BindingCount) {}
+
+    /*!
+     * @brief Whether the manifest satisfies the rules that `xrCreateActionSet`, `xrCreateAction` and
+     * `xrSuggestInteractionProfileBindings` would otherwise check at runtime.
+     *
+     * The rules checked: well-formed names that fit their buffers, unique action names and localized names,
+     * at most 32 subaction paths, all starting with `/user/`, subaction masks and binding action indices in range,
+     * and binding paths that look like interaction profile and `/user/` paths.
+     */
+    OPENXR_HPP_CONSTEXPR bool isValid() const noexcept {
+        return impl::manifest::isValidName(name_, XR_MAX_ACTION_SET_NAME_SIZE) &&
+               impl::manifest::isValidLocalizedName(localizedName_, XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE) &&
+               subactionPathCount_ <= 32 && subactionPathsValidFrom(0) && actionsValidFrom(0) && bindingsValidFrom(0);
+    }
+
+    //! Index of the action named @p name, or actionCount() if there is none.
+    OPENXR_HPP_CONSTEXPR uint32_t actionIndex(const char* name, uint32_t start = 0) const noexcept {
+        return start == actionCount_ || impl::manifest::equal(actions_[start].name, name) ? start : actionIndex(name, start + 1);
+    }
+
+    //! Action set name.
+    OPENXR_HPP_CONSTEXPR const char* name() const noexcept { return name_; }
+    //! Localized action set name.
+    OPENXR_HPP_CONSTEXPR const char* localizedName() const noexcept { return localizedName_; }
+    //! Action set priority.
+    OPENXR_HPP_CONSTEXPR uint32_t priority() const noexcept { return priority_; }
+    //! Number of actions.
+    OPENXR_HPP_CONSTEXPR uint32_t actionCount() const noexcept { return actionCount_; }
+    //! Action @p i.
+    OPENXR_HPP_CONSTEXPR ManifestAction const& action(uint32_t i) const noexcept { return actions_[i]; }
+    //! Number of subaction paths.
+    OPENXR_HPP_CONSTEXPR uint32_t subactionPathCount() const noexcept { return subactionPathCount_; }
+    //! Subaction path @p i.
+    OPENXR_HPP_CONSTEXPR const char* subactionPath(uint32_t i) const noexcept { return subactionPaths_[i]; }
+    //! Number of suggested bindings.
+    OPENXR_HPP_CONSTEXPR uint32_t bindingCount() const noexcept { return bindingCount_; }
+    //! Suggested binding @p i.
+    OPENXR_HPP_CONSTEXPR ManifestBinding const& binding(uint32_t i) const noexcept { return bindings_[i]; }
+
+   private:
+    OPENXR_HPP_CONSTEXPR bool subactionPathsValidFrom(uint32_t i) const noexcept {
+        return i == subactionPathCount_ ||
+               (impl::manifest::startsWith(subactionPaths_[i], "/user/") && subactionPathsValidFrom(i + 1));
+    }
+
+    OPENXR_HPP_CONSTEXPR bool namesDifferFrom(uint32_t i, uint32_t j) const noexcept {
+        return j == actionCount_ || (!impl::manifest::equal(actions_[i].name, actions_[j].name) &&
+                                     !impl::manifest::equal(actions_[i].localizedName, actions_[j].localizedName) &&
+                                     namesDifferFrom(i, j + 1));
+    }
+
+    OPENXR_HPP_CONSTEXPR bool actionsValidFrom(uint32_t i) const noexcept {
+        return i == actionCount_ ||
+               (impl::manifest::isValidName(actions_[i].name, XR_MAX_ACTION_NAME_SIZE) &&
+                impl::manifest::isValidLocalizedName(actions_[i].localizedName, XR_MAX_LOCALIZED_ACTION_NAME_SIZE) &&
+                (actions_[i].subactionPathMask & ~impl::manifest::lowBits(subactionPathCount_)) == 0 &&
+                namesDifferFrom(i, i + 1) && actionsValidFrom(i + 1));
+    }
+
+    OPENXR_HPP_CONSTEXPR bool bindingsValidFrom(uint32_t i) const noexcept {
+        return i == bindingCount_ ||
+               (bindings_[i].action < actionCount_ &&
+                impl::manifest::startsWith(bindings_[i].interactionProfile, "/interaction_profiles/") &&
+                impl::manifest::startsWith(bindings_[i].path, "/user/") && bindingsValidFrom(i + 1));
+    }
+
+    const char* name_;
+    const char* localizedName_;
+    uint32_t priority_;
+    ManifestAction const* actions_;
+    uint32_t actionCount_;
+    const char* const* subactionPaths_;
+    uint32_t subactionPathCount_;
+    ManifestBinding const* bindings_;
+    uint32_t bindingCount_;
+};
+
+/*!
+ * @brief The objects created from an ActionManifest by createActionManifest().
+ *
+ * Destroying the action set (which the caller owns) also destroys the actions.
+ *
+ * @ingroup utilities
+ */
+struct ActionManifestHandles {
+    //! The action set.
+    ActionSet actionSet;
+    //! The actions, in manifest order: index with ActionManifest::actionIndex().
+    std::vector<Action> actions;
+    //! The subaction paths, in manifest order.
+    std::vector<Path> subactionPaths;
+};
+
+namespace impl {
+namespace manifest {
+OPENXR_HPP_INLINE void copyName(char* dest, size_t size, const char* src) {
+    size_t length = std::strlen(src);
+    if (length >= size) {
+        length = size - 1;
+    }
+    std::memcpy(dest, src, length);
+    dest[length] = '\0';
+}
+
+// Index of the first of strings[0..i] equal to strings[i], so each distinct string is handled once.
+template <typename Getter>
+OPENXR_HPP_INLINE uint32_t firstOccurrence(uint32_t i, Getter const& get) {
+    for (uint32_t j = 0; j < i; ++j) {
+        if (std::strcmp(get(j), get(i)) == 0) {
+            return j;
+        }
+    }
+    return i;
+}
+
+struct BindingPath {
+    ActionManifest const& manifest;
+    const char* operator()(uint32_t i) const { return manifest.binding(i).path; }
+};
+
+struct BindingProfile {
+    ActionManifest const& manifest;
+    const char* operator()(uint32_t i) const { return manifest.binding(i).interactionProfile; }
+};
+}  // namespace manifest
+}  // namespace impl
+
+/*!
+ * @brief Create the action set, actions and suggested bindings described by @p manifest.
+ *
+ * Each distinct path string is converted with `xrStringToPath` once. `xrSuggestInteractionProfileBindings`
+ * is called once per interaction profile. On failure, anything created is destroyed and @p out is left empty.
+ *
+ * @ingroup utilities
+ */
+template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+OPENXR_HPP_INLINE Result createActionManifest(Instance instance, ActionManifest const& manifest, ActionManifestHandles& out,
+                                              Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+    out = ActionManifestHandles{};
+    const XrInstance rawInstance = instance.get();
+
+    std::vector<XrPath> subactionPaths(manifest.subactionPathCount());
+    for (uint32_t i = 0; i < manifest.subactionPathCount(); ++i) {
+        XrResult result = d.xrStringToPath(rawInstance, manifest.subactionPath(i), &subactionPaths[i]);
+        if (XR_FAILED(result)) {
+            return static_cast<Result>(result);
+        }
+    }
+
+    // Intern binding and profile paths before creating anything, so a bad path leaves nothing to clean up.
+    std::vector<XrPath> bindingPaths(manifest.bindingCount());
+    std::vector<XrPath> profilePaths(manifest.bindingCount());
+    impl::manifest::BindingPath getPath{manifest};
+    impl::manifest::BindingProfile getProfile{manifest};
+    for (uint32_t i = 0; i < manifest.bindingCount(); ++i) {
+        uint32_t first = impl::manifest::firstOccurrence(i, getPath);
+        XrResult result = first < i ? XR_SUCCESS : d.xrStringToPath(rawInstance, getPath(i), &bindingPaths[i]);
+        bindingPaths[i] = bindingPaths[first];
+        if (XR_SUCCEEDED(result)) {
+            first = impl::manifest::firstOccurrence(i, getProfile);
+            result = first < i ? XR_SUCCESS : d.xrStringToPath(rawInstance, getProfile(i), &profilePaths[i]);
+            profilePaths[i] = profilePaths[first];
+        }
+        if (XR_FAILED(result)) {
+            return static_cast<Result>(result);
+        }
+    }
+
+    XrActionSetCreateInfo setInfo{};
+    setInfo.type = XR_TYPE_ACTION_SET_CREATE_INFO;
+    impl::manifest::copyName(setInfo.actionSetName, XR_MAX_ACTION_SET_NAME_SIZE, manifest.name());
+    impl::manifest::copyName(setInfo.localizedActionSetName, XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE, manifest.localizedName());
+    setInfo.priority = manifest.priority();
+    XrActionSet actionSet = XR_NULL_HANDLE;
+    XrResult result = d.xrCreateActionSet(rawInstance, &setInfo, &actionSet);
+    if (XR_FAILED(result)) {
+        return static_cast<Result>(result);
+    }
+
+    std::vector<XrAction> actions(manifest.actionCount(), XR_NULL_HANDLE);
+    std::vector<XrPath> actionSubactionPaths;
+    actionSubactionPaths.reserve(subactionPaths.size());
+    for (uint32_t i = 0; i < manifest.actionCount() && XR_SUCCEEDED(result); ++i) {
+        ManifestAction const& action = manifest.action(i);
+        actionSubactionPaths.clear();
+        for (uint32_t p = 0; p < subactionPaths.size(); ++p) {
+            if ((action.subactionPathMask >> p) & 1u) {
+                actionSubactionPaths.push_back(subactionPaths[p]);
+            }
+        }
+        XrActionCreateInfo actionInfo{};
+        actionInfo.type = XR_TYPE_ACTION_CREATE_INFO;
+        impl::manifest::copyName(actionInfo.actionName, XR_MAX_ACTION_NAME_SIZE, action.name);
+        actionInfo.actionType = static_cast<XrActionType>(action.type);
+        actionInfo.countSubactionPaths = static_cast<uint32_t>(actionSubactionPaths.size());
+        actionInfo.subactionPaths = actionSubactionPaths.empty() ? nullptr : actionSubactionPaths.data();
+        impl::manifest::copyName(actionInfo.localizedActionName, XR_MAX_LOCALIZED_ACTION_NAME_SIZE, action.localizedName);
+        result = d.xrCreateAction(actionSet, &actionInfo, &actions[i]);
+    }
+
+    // One suggestion call per distinct profile, gathering its bindings.
+    std::vector<XrActionSuggestedBinding> suggested;
+    suggested.reserve(manifest.bindingCount());
+    for (uint32_t i = 0; i < manifest.bindingCount() && XR_SUCCEEDED(result); ++i) {
+        if (impl::manifest::firstOccurrence(i, getProfile) != i) {
+            continue;
+        }
+        suggested.clear();
+        for (uint32_t j = i; j < manifest.bindingCount(); ++j) {
+            if (profilePaths[j] == profilePaths[i]) {
+                suggested.push_back({actions[manifest.binding(j).action], bindingPaths[j]});
+            }
+        }
+        XrInteractionProfileSuggestedBinding profileBindings{};
+        profileBindings.type = XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING;
+        profileBindings.interactionProfile = profilePaths[i];
+        profileBindings.countSuggestedBindings = static_cast<uint32_t>(suggested.size());
+        profileBindings.suggestedBindings = suggested.data();
+        result = d.xrSuggestInteractionProfileBindings(rawInstance, &profileBindings);
+    }
+
+    if (XR_FAILED(result)) {
+        // Destroying the action set destroys its actions.
+        d.xrDestroyActionSet(actionSet);
+        return static_cast<Result>(result);
+    }
+
+    out.actionSet = ActionSet{actionSet};
+    out.actions.reserve(actions.size());
+    for (XrAction action : actions) {
+        out.actions.push_back(Action{action});
+    }
+    out.subactionPaths.reserve(subactionPaths.size());
+    for (XrPath path : subactionPaths) {
+        out.subactionPaths.push_back(Path{path});
+    }
+    return static_cast<Result>(result);
+}
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
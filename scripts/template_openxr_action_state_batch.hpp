@@ -0,0 +1,271 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a helper to read the state of many actions at once into packed arrays.
+ *
+ * @see xr::ActionStateBatch
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Reads the state of a fixed list of actions after each Session::syncActions() call.
+ *
+ * Declare every (action, subaction path) pair once with addBoolean(), addFloat(), addVector2f() and addPose().
+ * Then each update() queries the runtime in one loop per action type, reusing prebuilt `XrActionStateGetInfo`
+ * structures. It writes the results to packed arrays: one bit per action for boolean values, and one float
+ * per action (or per component) for the others.
+ *
+ * Declaring actions allocates; update() does not.
+ *
+ * @ingroup utilities
+ */
+class ActionStateBatch {
+   public:
+    //! A packed array of bits, one per declared action of a type.
+    class Bits {
+       public:
+        //! Number of bits.
+        size_t size() const noexcept { return size_; }
+        //! Value of bit @p i.
+        bool operator[](size_t i) const noexcept { return (words_[i / 64] >> (i % 64)) & 1u; }
+        //! Whether any bit is set.
+        bool any() const noexcept {
+            for (uint64_t word : words_) {
+                if (word != 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        //! The packed bits: bit `i % 64` of word `i / 64` is bit `i`.
+        uint64_t const* words() const noexcept { return words_.data(); }
+
+       private:
+        friend class ActionStateBatch;
+        void push_back() {
+            if (size_ % 64 == 0) {
+                words_.push_back(0);
+            }
+            ++size_;
+        }
+        void clear() noexcept {
+            for (uint64_t& word : words_) {
+                word = 0;
+            }
+        }
+        void set(size_t i, bool value) noexcept { words_[i / 64] |= uint64_t(value) << (i % 64); }
+
+        std::vector<uint64_t> words_;
+        size_t size_ = 0;
+    };
+
+    //! States of the boolean actions, indexed by the return value of addBoolean().
+    struct Booleans {
+        Bits currentState;
+        Bits changedSinceLastSync;
+        Bits isActive;
+    };
+
+    //! States of the float actions, indexed by the return value of addFloat().
+    struct Floats {
+        std::vector<float> currentState;
+        Bits changedSinceLastSync;
+        Bits isActive;
+    };
+
+    //! States of the 2D vector actions, indexed by the return value of addVector2f().
+    struct Vector2fs {
+        std::vector<float> x;
+        std::vector<float> y;
+        Bits changedSinceLastSync;
+        Bits isActive;
+    };
+
+    //! States of the pose actions, indexed by the return value of addPose().
+    struct Poses {
+        Bits isActive;
+    };
+
+    //! Declare a boolean action, returning its index in booleans().
+    uint32_t addBoolean(Action action, Path subactionPath = Path{}) {
+        booleanInfos_.push_back(makeInfo(action, subactionPath));
+        booleans_.currentState.push_back();
+        booleans_.changedSinceLastSync.push_back();
+        booleans_.isActive.push_back();
+        return static_cast<uint32_t>(booleanInfos_.size() - 1);
+    }
+
+    //! Declare a float action, returning its index in floats().
+    uint32_t addFloat(Action action, Path subactionPath = Path{}) {
+        floatInfos_.push_back(makeInfo(action, subactionPath));
+        floats_.currentState.push_back(0.f);
+        floats_.changedSinceLastSync.push_back();
+        floats_.isActive.push_back();
+        return static_cast<uint32_t>(floatInfos_.size() - 1);
+    }
+
+    //! Declare a 2D vector action, returning its index in vector2fs().
+    uint32_t addVector2f(Action action, Path subactionPath = Path{}) {
+        vector2fInfos_.push_back(makeInfo(action, subactionPath));
+        vector2fs_.x.push_back(0.f);
+        vector2fs_.y.push_back(0.f);
+        vector2fs_.changedSinceLastSync.push_back();
+        vector2fs_.isActive.push_back();
+        return static_cast<uint32_t>(vector2fInfos_.size() - 1);
+    }
+
+    //! Declare a pose action, returning its index in poses().
+    uint32_t addPose(Action action, Path subactionPath = Path{}) {
+        poseInfos_.push_back(makeInfo(action, subactionPath));
+        poses_.isActive.push_back();
+        return static_cast<uint32_t>(poseInfos_.size() - 1);
+    }
+
+    /*!
+     * @brief Query the state of every declared action. Call after each Session::syncActions().
+     *
+     * Every action is queried even if some fail; failed actions read as inactive with zero values.
+     *
+     * @returns Result::Success, or the first failing result.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result update(Session session, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        const XrSession rawSession = session.get();
+        XrResult firstFailure = XR_SUCCESS;
+
+        booleans_.currentState.clear();
+        booleans_.changedSinceLastSync.clear();
+        booleans_.isActive.clear();
+        for (size_t i = 0; i < booleanInfos_.size(); ++i) {
+            XrActionStateBoolean state{};
+            state.type = XR_TYPE_ACTION_STATE_BOOLEAN;
+            XrResult result = d.xrGetActionStateBoolean(rawSession, &booleanInfos_[i], &state);
+            if (!recordResult(result, firstFailure)) {
+                continue;
+            }
+            booleans_.currentState.set(i, state.currentState == XR_TRUE);
+            booleans_.changedSinceLastSync.set(i, state.changedSinceLastSync == XR_TRUE);
+            booleans_.isActive.set(i, state.isActive == XR_TRUE);
+        }
+
+        floats_.changedSinceLastSync.clear();
+        floats_.isActive.clear();
+        for (size_t i = 0; i < floatInfos_.size(); ++i) {
+            XrActionStateFloat state{};
+            state.type = XR_TYPE_ACTION_STATE_FLOAT;
+            XrResult result = d.xrGetActionStateFloat(rawSession, &floatInfos_[i], &state);
+            if (!recordResult(result, firstFailure)) {
+                state.currentState = 0.f;
+            }
+            floats_.currentState[i] = state.currentState;
+            floats_.changedSinceLastSync.set(i, state.changedSinceLastSync == XR_TRUE);
+            floats_.isActive.set(i, state.isActive == XR_TRUE);
+        }
+
+        vector2fs_.changedSinceLastSync.clear();
+        vector2fs_.isActive.clear();
+        for (size_t i = 0; i < vector2fInfos_.size(); ++i) {
+            XrActionStateVector2f state{};
+            state.type = XR_TYPE_ACTION_STATE_VECTOR2F;
+            XrResult result = d.xrGetActionStateVector2f(rawSession, &vector2fInfos_[i], &state);
+            if (!recordResult(result, firstFailure)) {
+                state.currentState = XrVector2f{0.f, 0.f};
+            }
+            vector2fs_.x[i] = state.currentState.x;
+            vector2fs_.y[i] = state.currentState.y;
+            vector2fs_.changedSinceLastSync.set(i, state.changedSinceLastSync == XR_TRUE);
+            vector2fs_.isActive.set(i, state.isActive == XR_TRUE);
+        }
+
+        poses_.isActive.clear();
+        for (size_t i = 0; i < poseInfos_.size(); ++i) {
+            XrActionStatePose state{};
+            state.type = XR_TYPE_ACTION_STATE_POSE;
+            XrResult result = d.xrGetActionStatePose(rawSession, &poseInfos_[i], &state);
+            if (recordResult(result, firstFailure)) {
+                poses_.isActive.set(i, state.isActive == XR_TRUE);
+            }
+        }
+        return static_cast<Result>(firstFailure);
+    }
+
+    //! States of the boolean actions, from the last update().
+    Booleans const& booleans() const noexcept { return booleans_; }
+    //! States of the float actions, from the last update().
+    Floats const& floats() const noexcept { return floats_; }
+    //! States of the 2D vector actions, from the last update().
+    Vector2fs const& vector2fs() const noexcept { return vector2fs_; }
+    //! States of the pose actions, from the last update().
+    Poses const& poses() const noexcept { return poses_; }
+
+   private:
+    static XrActionStateGetInfo makeInfo(Action action, Path subactionPath) noexcept {
+        return {XR_TYPE_ACTION_STATE_GET_INFO, nullptr, action.get(), subactionPath.get()};
+    }
+
+    // Returns whether result is a success, keeping the first failure.
+    static bool recordResult(XrResult result, XrResult& firstFailure) noexcept {
+        if (XR_SUCCEEDED(result)) {
+            return true;
+        }
+        if (XR_SUCCEEDED(firstFailure)) {
+            firstFailure = result;
+        }
+        return false;
+    }
+
+    std::vector<XrActionStateGetInfo> booleanInfos_;
+    std::vector<XrActionStateGetInfo> floatInfos_;
+    std::vector<XrActionStateGetInfo> vector2fInfos_;
+    std::vector<XrActionStateGetInfo> poseInfos_;
+    Booleans booleans_;
+    Floats floats_;
+    Vector2fs vector2fs_;
+    Poses poses_;
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
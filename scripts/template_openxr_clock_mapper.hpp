@@ -0,0 +1,251 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a lock-free mapping between xr::Time and a std::chrono clock, calibrated from occasional runtime calls.
+ *
+ * @see xr::ClockMapper
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+#include "openxr_time.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#if defined(XR_USE_PLATFORM_WIN32) && defined(XR_KHR_win32_convert_performance_counter_time)
+#include <windows.h>
+#endif
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Converts between xr::Time and time points of @p Clock, without calling the runtime.
+ *
+ * The runtime's conversion functions (such as `xrConvertTimespecTimeToTimeKHR`) are exact, but each call costs a
+ * trip through the loader and runtime. A ClockMapper instead keeps a linear model of XrTime against @p Clock,
+ * built from occasional samples of the runtime conversion. The model is anchored at the latest accepted sample and
+ * corrected for the rate at which the two clocks drift apart, which is estimated from the samples. Converting is a few
+ * arithmetic operations.
+ *
+ * Conversions take no locks and may run on any number of threads while another thread adds samples. Call
+ * sampleIfDue() once per frame, or addSample() with pairs from elsewhere, to keep the model current.
+ *
+ * @tparam Clock The clock to map to and from. sample() requires its epoch to match the platform clock the runtime
+ * converts: `CLOCK_MONOTONIC` for XR_KHR_convert_timespec_time, as for `std::chrono::steady_clock` on Linux and
+ * Android.
+ *
+ * @ingroup utilities
+ */
+template <typename Clock = std::chrono::steady_clock>
+class ClockMapper {
+   public:
+    using time_point = typename Clock::time_point;
+
+    //! Largest clock drift accepted from samples, as a fraction: samples implying more are treated as outliers.
+    static OPENXR_HPP_CONSTEXPR double maxDrift() noexcept { return 1e-3; }
+
+    //! Construct an uncalibrated mapper. sampleIfDue() samples at most once every @p resampleInterval.
+    explicit ClockMapper(Duration resampleInterval = Duration{std::chrono::seconds(1)}) noexcept
+        : resampleInterval_(resampleInterval.get()) {}
+
+    ClockMapper(ClockMapper const&) = delete;
+    ClockMapper& operator=(ClockMapper const&) = delete;
+
+    /*!
+     * @brief Add a pair of simultaneous readings of @p Clock and the runtime clock, and update the model.
+     *
+     * Samples at least half the resample interval after the previous drift reference also update the drift estimate.
+     * Those implying a drift beyond maxDrift() are outliers, such as a runtime call delayed by preemption, and leave the
+     * model unchanged.
+     */
+    void addSample(time_point clockTime, Time xrTime) noexcept {
+        const int64_t clockNs = nanosecondsOf(clockTime);
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        double drift = drift_.load(std::memory_order_relaxed);
+        const int64_t baseline = clockNs - referenceClock_;
+        if (sampleCount_ == 0 || baseline < 0) {
+            referenceClock_ = clockNs;
+            referenceXr_ = xrTime.get();
+        } else if (baseline >= resampleInterval_ / 2) {
+            const double measured = double((xrTime.get() - referenceXr_) - baseline) / double(baseline);
+            if (measured > maxDrift() || measured < -maxDrift()) {
+                // Keep the anchor and reference too, so that one bad sample does not shift every conversion.
+                lastSampleClock_.store(clockNs, std::memory_order_relaxed);
+                return;
+            }
+            // Smooth out the sampling jitter of individual runtime calls.
+            drift = haveDrift_ ? drift + (measured - drift) * 0.25 : measured;
+            haveDrift_ = true;
+            referenceClock_ = clockNs;
+            referenceXr_ = xrTime.get();
+        }
+        ++sampleCount_;
+        lastSampleClock_.store(clockNs, std::memory_order_relaxed);
+
+        const uint64_t version = version_.load(std::memory_order_relaxed);
+        version_.store(version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        anchorClock_.store(clockNs, std::memory_order_relaxed);
+        anchorXr_.store(xrTime.get(), std::memory_order_relaxed);
+        drift_.store(drift, std::memory_order_relaxed);
+        version_.store(version + 2, std::memory_order_release);
+    }
+
+    //! True once at least one sample has been added.
+    bool calibrated() const noexcept { return version_.load(std::memory_order_acquire) != 0; }
+
+    //! Convert a @p Clock time point to an XrTime. Returns an invalid Time until calibrated().
+    Time toTime(time_point clockTime) const noexcept {
+        Model model;
+        if (!load(model)) {
+            return Time{};
+        }
+        const int64_t delta = nanosecondsOf(clockTime) - model.anchorClock;
+        return Time{model.anchorXr + delta + static_cast<int64_t>(double(delta) * model.drift)};
+    }
+
+    //! Convert an XrTime to a @p Clock time point. Returns the clock's epoch until calibrated().
+    time_point toTimePoint(Time xrTime) const noexcept {
+        Model model;
+        if (!load(model)) {
+            return time_point{};
+        }
+        const int64_t delta = xrTime.get() - model.anchorXr;
+        const int64_t clockNs = model.anchorClock + delta - static_cast<int64_t>(double(delta) * model.drift / (1.0 + model.drift));
+        return time_point{std::chrono::duration_cast<typename Clock::duration>(std::chrono::nanoseconds{clockNs})};
+    }
+
+    //! The XrTime now, according to the model.
+    Time now() const noexcept { return toTime(Clock::now()); }
+
+    //! Estimated rate of the runtime clock relative to @p Clock, minus one: 1e-6 means it runs 1 ppm fast.
+    double drift() const noexcept { return drift_.load(std::memory_order_relaxed); }
+
+    //! True if no sample has been added for the resample interval.
+    bool sampleDue() const noexcept {
+        return !calibrated() || nanosecondsOf(Clock::now()) - lastSampleClock_.load(std::memory_order_relaxed) >= resampleInterval_;
+    }
+
+#if (defined(XR_USE_TIMESPEC) && defined(XR_KHR_convert_timespec_time)) || \
+    (defined(XR_USE_PLATFORM_WIN32) && defined(XR_KHR_win32_convert_performance_counter_time)) || defined(OPENXR_HPP_DOXYGEN)
+    /*!
+     * @brief Sample the runtime's conversion of the current time, and add it with addSample().
+     *
+     * Uses XR_KHR_convert_timespec_time or XR_KHR_win32_convert_performance_counter_time, whichever is available.
+     * Only declared if `<openxr/openxr_platform.h>` was included, with `XR_USE_TIMESPEC` or `XR_USE_PLATFORM_WIN32`
+     * defined, before this header.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_EXT_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result sample(Instance instance, Dispatch&& d OPENXR_HPP_DEFAULT_EXT_DISPATCH_ARG) noexcept {
+        XrTime xrTime = 0;
+#if defined(XR_USE_TIMESPEC) && defined(XR_KHR_convert_timespec_time)
+        const time_point clockTime = Clock::now();
+        const int64_t clockNs = nanosecondsOf(clockTime);
+        timespec ts{};
+        ts.tv_sec = static_cast<decltype(ts.tv_sec)>(clockNs / 1000000000);
+        ts.tv_nsec = static_cast<decltype(ts.tv_nsec)>(clockNs % 1000000000);
+        const Result result = static_cast<Result>(d.xrConvertTimespecTimeToTimeKHR(instance.get(), &ts, &xrTime));
+#else
+        LARGE_INTEGER counter;
+        QueryPerformanceCounter(&counter);
+        const time_point clockTime = Clock::now();
+        const Result result = static_cast<Result>(d.xrConvertWin32PerformanceCounterToTimeKHR(instance.get(), &counter, &xrTime));
+#endif
+        if (succeeded(result)) {
+            addSample(clockTime, Time{xrTime});
+        }
+        return result;
+    }
+
+    //! Call sample() if sampleDue(). Cheap enough to call every frame.
+    template <typename Dispatch OPENXR_HPP_DEFAULT_EXT_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result sampleIfDue(Instance instance, Dispatch&& d OPENXR_HPP_DEFAULT_EXT_DISPATCH_ARG) noexcept {
+        return sampleDue() ? sample(instance, d) : Result::Success;
+    }
+#endif
+
+   private:
+    struct Model {
+        int64_t anchorClock;
+        XrTime anchorXr;
+        double drift;
+    };
+
+    static int64_t nanosecondsOf(time_point clockTime) noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(clockTime.time_since_epoch()).count();
+    }
+
+    // Seqlock read: the version is odd while addSample() is changing the model.
+    bool load(Model& model) const noexcept {
+        while (true) {
+            const uint64_t before = version_.load(std::memory_order_acquire);
+            if (before == 0) {
+                return false;
+            }
+            model.anchorClock = anchorClock_.load(std::memory_order_relaxed);
+            model.anchorXr = anchorXr_.load(std::memory_order_relaxed);
+            model.drift = drift_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if ((before & 1) == 0 && version_.load(std::memory_order_relaxed) == before) {
+                return true;
+            }
+        }
+    }
+
+    std::atomic<uint64_t> version_{0};
+    std::atomic<int64_t> anchorClock_{0};
+    std::atomic<XrTime> anchorXr_{0};
+    std::atomic<double> drift_{0.0};
+    // When the latest sample was taken, even if it was rejected, so that outliers do not make sampling continuous.
+    std::atomic<int64_t> lastSampleClock_{0};
+    const int64_t resampleInterval_;
+
+    // Only used by addSample(), under writeMutex_.
+    std::mutex writeMutex_;
+    int64_t referenceClock_ = 0;
+    XrTime referenceXr_ = 0;
+    uint64_t sampleCount_ = 0;
+    bool haveDrift_ = false;
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
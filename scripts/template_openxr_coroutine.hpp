@@ -0,0 +1,551 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains C++20 coroutine awaitables for OpenXR calls that block or must be polled, and an executor to drive them.
+ *
+ * Everything in this file requires compiler and library support for C++20 coroutines, and is otherwise omitted.
+ *
+ * @see xr::coro::Executor, xr::coro::Task
+ * @ingroup utilities
+ */
+
+#include "openxr_frame_pipeline.hpp"
+#include "openxr_handles.hpp"
+#include "openxr_structs.hpp"
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define OPENXR_HPP_HAS_COROUTINES
+#endif
+#endif
+
+#ifdef OPENXR_HPP_HAS_COROUTINES
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//# include('define_assert.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+namespace coro {
+class Executor;
+template <typename T>
+class Task;
+}  // namespace coro
+
+namespace impl {
+/*!
+ * @brief An operation a coroutine is suspended on, polled by coro::Executor until it completes.
+ *
+ * Awaiters derive from this and live in the awaiting coroutine's frame, so parking allocates nothing.
+ */
+class ParkedOperation {
+   public:
+    //! Return true once the operation has completed and the coroutine may resume.
+    virtual bool poll() noexcept = 0;
+
+   protected:
+    ParkedOperation() = default;
+    ParkedOperation(ParkedOperation const&) = delete;
+    ParkedOperation& operator=(ParkedOperation const&) = delete;
+    ~ParkedOperation() = default;
+
+    //! Only poll once this time is reached, instead of on every executor tick.
+    void setWakeTime(std::chrono::steady_clock::time_point wakeTime) noexcept {
+        wakeTime_ = wakeTime;
+        timerOnly_ = true;
+    }
+
+    std::chrono::steady_clock::time_point wakeTime() const noexcept { return wakeTime_; }
+
+   private:
+    friend class coro::Executor;
+    ParkedOperation* next_ = nullptr;
+    std::coroutine_handle<> handle_;
+    std::chrono::steady_clock::time_point wakeTime_;
+    bool timerOnly_ = false;
+};
+
+template <typename T>
+class TaskPromise;
+
+//! Resumes the awaiting coroutine, if any, when a task finishes; detached tasks destroy themselves.
+template <typename T>
+struct TaskFinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<TaskPromise<T>> handle) noexcept {
+        TaskPromise<T>& promise = handle.promise();
+        if (promise.continuation) {
+            return promise.continuation;
+        }
+        if (promise.detached) {
+            if (promise.exception) {
+                std::terminate();
+            }
+            handle.destroy();
+        }
+        return std::noop_coroutine();
+    }
+    void await_resume() const noexcept {}
+};
+
+template <typename T>
+class TaskPromiseBase {
+   public:
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    TaskFinalAwaiter<T> final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+    bool detached = false;
+};
+
+template <typename T>
+class TaskPromise : public TaskPromiseBase<T> {
+   public:
+    coro::Task<T> get_return_object() noexcept;
+    template <typename U>
+    void return_value(U&& value) {
+        value_.emplace(std::forward<U>(value));
+    }
+    T take() {
+        if (this->exception) {
+            std::rethrow_exception(this->exception);
+        }
+        return std::move(*value_);
+    }
+
+   private:
+    std::optional<T> value_;
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase<void> {
+   public:
+    coro::Task<void> get_return_object() noexcept;
+    void return_void() const noexcept {}
+    void take() const {
+        if (this->exception) {
+            std::rethrow_exception(this->exception);
+        }
+    }
+};
+}  // namespace impl
+
+//! @brief Coroutine types and awaitables for asynchronous OpenXR calls.
+namespace coro {
+
+/*!
+ * @brief A lazily-started coroutine returning @p T.
+ *
+ * A task starts when it is first awaited, or when handed to Executor::spawn(). Awaiting it returns its result, or
+ * rethrows the exception it exited with.
+ *
+ * @ingroup utilities
+ */
+template <typename T = void>
+class Task;
+
+template <typename T>
+class Task {
+   public:
+    using promise_type = impl::TaskPromise<T>;
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        std::swap(handle_, other.handle_);
+        return *this;
+    }
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+    T await_resume() { return handle_.promise().take(); }
+
+   private:
+    friend class impl::TaskPromise<T>;
+    friend class Executor;
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/*!
+ * @brief A single-threaded reactor that resumes coroutines when the OpenXR operations they await complete.
+ *
+ * Awaitables from this namespace park their coroutine with the executor instead of blocking. Each tick, the
+ * executor polls the parked operations with non-blocking calls (for example `xrWaitSwapchainImage` with a zero timeout)
+ * and resumes the coroutines whose operations are complete. A single thread running run() can therefore juggle many
+ * outstanding OpenXR operations without blocking threads or spinning.
+ *
+ * An executor and everything parked on it must be used from one thread.
+ *
+ * @ingroup utilities
+ */
+class Executor {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    //! Construct an executor that, when idle, polls pending operations every @p pollInterval.
+    explicit Executor(Clock::duration pollInterval = std::chrono::milliseconds(1)) noexcept : pollInterval_(pollInterval) {}
+    Executor(Executor const&) = delete;
+    Executor& operator=(Executor const&) = delete;
+    //! Destroys spawned tasks that have not started. Run until idle() first: tasks still parked are leaked.
+    ~Executor() {
+        for (std::coroutine_handle<> handle : ready_) {
+            handle.destroy();
+        }
+    }
+
+    //! Start @p task on the next tick. The executor owns it from now on, and the task destroys itself when it finishes.
+    void spawn(Task<void> task) {
+        task.handle_.promise().detached = true;
+        ready_.push_back(std::exchange(task.handle_, nullptr));
+    }
+
+    //! Suspend the coroutine @p handle until @p operation completes. Used by awaiters.
+    void park(impl::ParkedOperation& operation, std::coroutine_handle<> handle) noexcept {
+        operation.handle_ = handle;
+        operation.next_ = nullptr;
+        *parkedTail_ = &operation;
+        parkedTail_ = &operation.next_;
+        ++parkedCount_;
+    }
+
+    //! Resume newly spawned tasks, then poll every parked operation once and resume those that completed.
+    size_t runOnce() {
+        size_t resumed = 0;
+        std::vector<std::coroutine_handle<>> ready;
+        ready.swap(ready_);
+        for (std::coroutine_handle<> handle : ready) {
+            handle.resume();
+            ++resumed;
+        }
+
+        impl::ParkedOperation* operation = parked_;
+        parked_ = nullptr;
+        parkedTail_ = &parked_;
+        parkedCount_ = 0;
+        const Clock::time_point now = Clock::now();
+        while (operation != nullptr) {
+            impl::ParkedOperation* next = operation->next_;
+            if ((!operation->timerOnly_ || operation->wakeTime_ <= now) && operation->poll()) {
+                // The operation lives in the coroutine frame, so it must not be touched after this.
+                operation->handle_.resume();
+                ++resumed;
+            } else {
+                park(*operation, operation->handle_);
+            }
+            operation = next;
+        }
+        return resumed;
+    }
+
+    /*!
+     * @brief Run until no task is ready or parked.
+     *
+     * Between ticks that resume nothing, sleeps until the earliest timer, or for the poll interval if any
+     * parked operation needs polling.
+     */
+    void run() {
+        while (!idle()) {
+            if (runOnce() == 0 && ready_.empty()) {
+                std::this_thread::sleep_until(nextWakeTime());
+            }
+        }
+    }
+
+    //! True if nothing is ready to run and nothing is parked.
+    bool idle() const noexcept { return ready_.empty() && parked_ == nullptr; }
+
+    //! Number of operations currently parked.
+    size_t parkedCount() const noexcept { return parkedCount_; }
+
+   private:
+    Clock::time_point nextWakeTime() const noexcept {
+        const Clock::time_point now = Clock::now();
+        Clock::time_point wake = Clock::time_point::max();
+        for (impl::ParkedOperation const* operation = parked_; operation != nullptr; operation = operation->next_) {
+            const Clock::time_point time = operation->timerOnly_ ? operation->wakeTime_ : now + pollInterval_;
+            if (time < wake) {
+                wake = time;
+            }
+        }
+        return wake;
+    }
+
+    Clock::duration pollInterval_;
+    std::vector<std::coroutine_handle<>> ready_;
+    impl::ParkedOperation* parked_ = nullptr;
+    impl::ParkedOperation** parkedTail_ = &parked_;
+    size_t parkedCount_ = 0;
+};
+
+}  // namespace coro
+
+namespace impl {
+template <typename T>
+OPENXR_HPP_INLINE coro::Task<T> TaskPromise<T>::get_return_object() noexcept {
+    return coro::Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+OPENXR_HPP_INLINE coro::Task<void> TaskPromise<void>::get_return_object() noexcept {
+    return coro::Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+/*!
+ * @brief Awaiter that calls @p F until it reports completion, parking the coroutine in between.
+ *
+ * `F` is called as `bool(R& result)`: it returns true once done, having stored the result to return from `co_await`.
+ */
+template <typename R, typename F>
+class PollingAwaiter final : public ParkedOperation {
+   public:
+    PollingAwaiter(coro::Executor& executor, F&& f) : executor_(executor), f_(std::move(f)) {}
+
+    bool await_ready() noexcept { return poll(); }
+    void await_suspend(std::coroutine_handle<> handle) noexcept { executor_.park(*this, handle); }
+    R await_resume() noexcept { return std::move(result_); }
+
+    bool poll() noexcept override { return f_(result_); }
+
+   private:
+    coro::Executor& executor_;
+    F f_;
+    R result_{};
+};
+
+template <typename R, typename F>
+OPENXR_HPP_INLINE PollingAwaiter<R, F> makePollingAwaiter(coro::Executor& executor, F&& f) {
+    return PollingAwaiter<R, F>(executor, std::forward<F>(f));
+}
+
+/*!
+ * @brief Awaiter that polls a caller's condition until it returns true, parking the coroutine in between.
+ *
+ * Unlike PollingAwaiter, the condition may throw: the exception is caught while polling, which the executor does
+ * outside of any coroutine, and rethrown from `co_await`.
+ */
+template <typename F>
+class ConditionAwaiter final : public ParkedOperation {
+   public:
+    ConditionAwaiter(coro::Executor& executor, F&& condition) : executor_(executor), condition_(std::move(condition)) {}
+
+    bool await_ready() noexcept { return poll(); }
+    void await_suspend(std::coroutine_handle<> handle) noexcept { executor_.park(*this, handle); }
+    bool await_resume() const {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+        return true;
+    }
+
+    bool poll() noexcept override {
+        try {
+            return static_cast<bool>(condition_());
+        } catch (...) {
+            exception_ = std::current_exception();
+            return true;
+        }
+    }
+
+   private:
+    coro::Executor& executor_;
+    F condition_;
+    std::exception_ptr exception_;
+};
+
+//! Awaiter that resumes its coroutine at a given time.
+class SleepAwaiter final : public ParkedOperation {
+   public:
+    SleepAwaiter(coro::Executor& executor, std::chrono::steady_clock::time_point wakeTime) noexcept : executor_(executor) {
+        setWakeTime(wakeTime);
+    }
+
+    bool await_ready() noexcept { return poll(); }
+    void await_suspend(std::coroutine_handle<> handle) noexcept { executor_.park(*this, handle); }
+    void await_resume() const noexcept {}
+
+    bool poll() noexcept override { return std::chrono::steady_clock::now() >= wakeTime(); }
+
+   private:
+    coro::Executor& executor_;
+};
+
+//! The time @p timeout from now, saturating instead of overflowing for long timeouts such as Duration::infinite().
+OPENXR_HPP_INLINE std::chrono::steady_clock::time_point deadlineAfter(Duration timeout) noexcept {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point now = Clock::now();
+    const std::chrono::nanoseconds remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::time_point::max() - now);
+    return timeout.get() >= remaining.count() ? Clock::time_point::max()
+                                              : now + std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(timeout.get()));
+}
+}  // namespace impl
+
+namespace coro {
+
+/*!
+ * @brief Suspend until @p wakeTime.
+ * @ingroup utilities
+ */
+OPENXR_HPP_INLINE impl::SleepAwaiter sleepUntil(Executor& executor, Executor::Clock::time_point wakeTime) noexcept {
+    return impl::SleepAwaiter(executor, wakeTime);
+}
+
+/*!
+ * @brief Suspend for @p duration.
+ * @ingroup utilities
+ */
+OPENXR_HPP_INLINE impl::SleepAwaiter sleepFor(Executor& executor, Executor::Clock::duration duration) noexcept {
+    return impl::SleepAwaiter(executor, Executor::Clock::now() + duration);
+}
+
+/*!
+ * @brief Suspend until @p condition, polled on each executor tick, returns true.
+ *
+ * Use this to await asynchronous operations not covered by a dedicated awaitable here. If @p condition throws, polling
+ * stops and the exception is rethrown from `co_await`.
+ *
+ * @ingroup utilities
+ */
+template <typename F>
+OPENXR_HPP_INLINE impl::ConditionAwaiter<F> pollUntil(Executor& executor, F condition) {
+    return impl::ConditionAwaiter<F>(executor, std::move(condition));
+}
+
+/*!
+ * @brief Suspend until @p pipeline has waited for the next frame, and store it in @p frame.
+ *
+ * This is the non-blocking counterpart of Session::waitFrame(): the FramePipeline's pacing thread is the only one that
+ * blocks in `xrWaitFrame`. Results in false, instead of a frame, once the pipeline has stopped.
+ *
+ * @ingroup utilities
+ */
+template <typename Dispatch>
+OPENXR_HPP_INLINE auto nextFrame(Executor& executor, FramePipeline<Dispatch>& pipeline, PipelinedFrame& frame) {
+    return impl::makePollingAwaiter<bool>(executor, [&pipeline, &frame](bool& acquired) noexcept {
+        acquired = pipeline.tryAcquireFrame(frame);
+        return acquired || pipeline.stopped();
+    });
+}
+
+/*!
+ * @brief Suspend until the image most recently acquired from @p swapchain is ready, or @p timeout passes.
+ *
+ * The awaitable counterpart of Swapchain::waitSwapchainImage(). Polls `xrWaitSwapchainImage` with a zero timeout, and
+ * results in the first result other than Result::TimeoutExpired, or in Result::TimeoutExpired once @p timeout passes.
+ *
+ * @ingroup utilities
+ */
+template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+OPENXR_HPP_INLINE auto waitSwapchainImage(Executor& executor, Swapchain swapchain, Duration timeout = Duration::infinite(),
+                                          Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+    const Executor::Clock::time_point deadline = impl::deadlineAfter(timeout);
+    return impl::makePollingAwaiter<Result>(
+        executor, [swapchain, deadline, d = typename std::decay<Dispatch>::type(d)](Result& result) mutable noexcept {
+            XrSwapchainImageWaitInfo waitInfo{};
+            waitInfo.type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
+            waitInfo.timeout = XR_NO_DURATION;
+            result = static_cast<Result>(d.xrWaitSwapchainImage(swapchain.get(), &waitInfo));
+            return result != Result::TimeoutExpired || Executor::Clock::now() >= deadline;
+        });
+}
+
+/*!
+ * @brief Suspend until an event is available from @p instance, and store it in @p event.
+ *
+ * The awaitable counterpart of Instance::pollEvent(). Results in Result::Success once an event has been stored, or in
+ * the error `xrPollEvent` returned.
+ *
+ * @ingroup utilities
+ */
+template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+OPENXR_HPP_INLINE auto nextEvent(Executor& executor, Instance instance, EventDataBuffer& event,
+                                 Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+    return impl::makePollingAwaiter<Result>(
+        executor, [instance, &event, d = typename std::decay<Dispatch>::type(d)](Result& result) mutable noexcept {
+            result = static_cast<Result>(d.xrPollEvent(instance.get(), event.put()));
+            return result != Result::EventUnavailable;
+        });
+}
+
+#if defined(XR_MSFT_scene_understanding)
+/*!
+ * @brief Suspend until the scene computation started with SceneObserverMSFT::computeNewSceneMSFT() finishes.
+ *
+ * Polls `xrGetSceneComputeStateMSFT`, storing the last state in @p state. Results in Result::Success once @p state is
+ * SceneComputeStateMSFT::Completed or SceneComputeStateMSFT::CompletedWithError, or in the error the poll returned.
+ *
+ * @ingroup utilities
+ */
+template <typename Dispatch OPENXR_HPP_DEFAULT_EXT_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+OPENXR_HPP_INLINE auto sceneComputed(Executor& executor, SceneObserverMSFT sceneObserver, SceneComputeStateMSFT& state,
+                                     Dispatch&& d OPENXR_HPP_DEFAULT_EXT_DISPATCH_ARG) {
+    return impl::makePollingAwaiter<Result>(
+        executor, [sceneObserver, &state, d = typename std::decay<Dispatch>::type(d)](Result& result) mutable noexcept {
+            XrSceneComputeStateMSFT raw = XR_SCENE_COMPUTE_STATE_NONE_MSFT;
+            result = static_cast<Result>(d.xrGetSceneComputeStateMSFT(sceneObserver.get(), &raw));
+            state = static_cast<SceneComputeStateMSFT>(raw);
+            return failed(result) || raw == XR_SCENE_COMPUTE_STATE_COMPLETED_MSFT ||
+                   raw == XR_SCENE_COMPUTE_STATE_COMPLETED_WITH_ERROR_MSFT;
+        });
+}
+#endif  // defined(XR_MSFT_scene_understanding)
+
+}  // namespace coro
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+#endif  // OPENXR_HPP_HAS_COROUTINES
+
+//# include('file_footer.hpp')
@@ -46,6 +46,8 @@
  */
 
 #include <openxr/openxr.h>
+
+#include <chrono>
 //# endblock
 
 //## No validity methods
@@ -53,6 +55,14 @@
 //# endblock
 
 //# block extra_methods
+//! Explicit constructor from a std::chrono::duration, truncated to whole nanoseconds.
+template <typename Rep, typename Period>
+OPENXR_HPP_CONSTEXPR explicit Duration(std::chrono::duration<Rep, Period> d) noexcept
+    : val_(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) {}
+
+//! Convert to std::chrono::nanoseconds.
+OPENXR_HPP_CONSTEXPR std::chrono::nanoseconds toChrono() const noexcept { return std::chrono::nanoseconds{val_}; }
+
 //! Add a Duration to the current Duration
 Duration& operator+=(Duration d) noexcept {
     val_ += d.val_;
@@ -0,0 +1,192 @@
+//## Copyright (c) 2017-2021 The Khronos Group Inc.
+//## Copyright (c) 2019-2021 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+//# from 'macros.hpp' import make_enum_value_table
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains from_string(), which parses enum values and flag bits from their C++ or C names.
+ *
+ * A name is hashed once and compared against the one entry of a generated perfect hash table that it could be.
+ * Kept apart from openxr_enums.hpp and openxr_flags.hpp, since the tables of names add to the time to compile them.
+ *
+ * @ingroup enums
+ */
+
+#include "openxr_flags.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__has_include) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#if __has_include(<optional>) && __has_include(<string_view>)
+#include <optional>
+#include <string_view>
+#if defined(__cpp_lib_optional) && defined(__cpp_lib_string_view)
+#define OPENXR_HPP_HAS_OPTIONAL
+#define OPENXR_HPP_HAS_STRING_VIEW
+#endif
+#endif
+#endif
+
+//# include('define_inline_constexpr.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+//! Implementation details
+namespace impl {
+//! Hashes the words from @p str up to the one at @p last, which is the last eight bytes of the string. Recursive to
+//! be constexpr in C++11, so not forced inline, as is namesEqualFrom().
+inline OPENXR_HPP_CONSTEXPR uint32_t nameHashFrom(const char* str, const char* last, uint64_t hash) {
+    return str < last ? nameHashFrom(str + 8, last, mixNameWord(hash, loadWord(str)))
+                      : static_cast<uint32_t>(mixNameWord(hash, loadWord(last)));
+}
+
+//! The hash of a name before its first word: its length, with the seed in the upper half.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint64_t nameHashStart(size_t length, uint32_t seed) {
+    return uint64_t(length) ^ (uint64_t(seed) << 32);
+}
+
+//! Hashes a string eight bytes at a time, reducing names to keys for the perfect hash tables. The seed is picked per
+//! table, so that its names all get different keys. Mirrors scripts/perfect_hash.py.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t nameHash(const char* str, size_t length, uint32_t seed) {
+    return length < 8 ? static_cast<uint32_t>(mixNameWord(nameHashStart(length, seed), loadPartialWord(str, length)))
+                      : nameHashFrom(str, str + length - 8, nameHashStart(length, seed));
+}
+
+inline OPENXR_HPP_CONSTEXPR bool namesEqualFrom(const char* name, const char* str, const char* last) {
+    return str < last ? loadWord(name) == loadWord(str) && namesEqualFrom(name + 8, str + 8, last)
+                      : loadWord(name + (last - str)) == loadWord(last);
+}
+
+//! Whether the @p length characters at @p name and at @p str are the same, compared eight at a time.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE bool namesEqual(const char* name, const char* str, size_t length) {
+    return length < 8 ? loadPartialWord(name, length) == loadPartialWord(str, length)
+                      : namesEqualFrom(name, str, str + length - 8);
+}
+
+//! A slot of a table from names to enum or flag bit values: a name, its length and its value, or a null name if empty.
+struct EnumValueSlot {
+    const char* name;
+    size_t length;
+    int64_t value;
+};
+
+//! Perfect hash table from the C++ and C names of an enum's or flag bits type's values to the values, with the static
+//! `nameSeed` to hash names with, and static `seeds` and `slots` arrays whose sizes are powers of two. Specialized for
+//! each enum and flag bits type.
+template <typename E, typename Dummy = void>
+struct EnumValueTable;
+
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const EnumValueSlot* enumValueInSlot(EnumValueSlot const& slot, const char* str,
+                                                                            size_t length) {
+    return slot.length == length && slot.name != nullptr && namesEqual(slot.name, str, length) ? &slot : nullptr;
+}
+
+template <size_t SeedCount, size_t SlotCount>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const EnumValueSlot* findEnumValueByKey(const uint16_t (&seeds)[SeedCount],
+                                                                               const EnumValueSlot (&slots)[SlotCount],
+                                                                               uint32_t key, const char* str, size_t length) {
+    return enumValueInSlot(slots[perfectHashSlot<SlotCount>(seeds, key)], str, length);
+}
+
+//! Looks up a name in an EnumValueTable: one pass to hash it, two loads, and one comparison against the only
+//! candidate. Returns nullptr if there is no such name.
+template <size_t SeedCount, size_t SlotCount>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const EnumValueSlot* findEnumValue(const uint16_t (&seeds)[SeedCount],
+                                                                          const EnumValueSlot (&slots)[SlotCount],
+                                                                          uint32_t nameSeed, const char* str,
+                                                                          size_t length) {
+    return findEnumValueByKey(seeds, slots, nameHash(str, length, nameSeed), str, length);
+}
+}  // namespace impl
+
+//! @addtogroup enums
+//! @{
+
+//! @brief Parses the C++ name (as returned by to_string_literal()) or the C name of a value of enum or flag bits
+//! type E from the @p length characters at @p str.
+//!
+//! Returns false, leaving @p value unchanged, if E has no such value.
+template <typename E>
+OPENXR_HPP_INLINE bool from_string(const char* str, size_t length, E& value) {
+    const impl::EnumValueSlot* slot =
+        impl::findEnumValue(impl::EnumValueTable<E>::seeds, impl::EnumValueTable<E>::slots,
+                            impl::EnumValueTable<E>::nameSeed, str, length);
+    if (slot == nullptr) {
+        return false;
+    }
+    value = static_cast<E>(slot->value);
+    return true;
+}
+
+//! @brief Parses the C++ or C name of a value of enum or flag bits type E from a null-terminated string.
+template <typename E>
+OPENXR_HPP_INLINE bool from_string(const char* str, E& value) {
+    return from_string(str, strlen(str), value);
+}
+
+#if defined(OPENXR_HPP_HAS_OPTIONAL) && defined(OPENXR_HPP_HAS_STRING_VIEW)
+//! @brief Parses the C++ or C name of a value of enum or flag bits type E, in a constant expression if need be.
+//!
+//! Returns an empty optional if E has no such value.
+template <typename E>
+constexpr std::optional<E> from_string(std::string_view name) noexcept {
+    const impl::EnumValueSlot* slot =
+        impl::findEnumValue(impl::EnumValueTable<E>::seeds, impl::EnumValueTable<E>::slots,
+                            impl::EnumValueTable<E>::nameSeed, name.data(), name.size());
+    return slot != nullptr ? std::optional<E>{static_cast<E>(slot->value)} : std::nullopt;
+}
+#endif  // defined(OPENXR_HPP_HAS_OPTIONAL) && defined(OPENXR_HPP_HAS_STRING_VIEW)
+
+//! @}
+//# for enum in gen.api_enums
+//#     if not enum.alias
+/*{ protect_begin(enum) }*/
+/*{ make_enum_value_table(project_type_name(enum.name), enum_value_table(enum)) }*/
+/*{ protect_end(enum) }*/
+//#     endif
+//# endfor
+//# for flags in gen.api_flags
+//#     if not flags.alias
+/*{ protect_begin(flags) }*/
+/*{ make_enum_value_table(project_type_name(flags.valid_flags), flag_value_table(flags)) }*/
+/*{ protect_end(flags) }*/
+//#     endif
+//# endfor
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
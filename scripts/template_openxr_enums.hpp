@@ -48,6 +48,8 @@
 #include <openxr/openxr_platform.h>
 #endif
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 // Fix name collisions from noisy includes
@@ -70,12 +72,141 @@ namespace OPENXR_HPP_NAMESPACE {
  * All enumerations have three utility functions defined:
  *
  * - get() - returns the raw C enum value
- * - to_string_literal() - returns a const char* containing the C++ name
+ * - to_string_literal() - returns a const char* containing the C++ name. For large enums with sparse values, such as
+ *   StructureType and Result, the name is found in a generated perfect hash table in constant time, and the function
+ *   is constexpr.
  * - to_string() - wraps to_string_literal(), returning a std::string
  *
+ * Enumerations and flag bits can also be parsed from either their C++ or their C names with from_string(), from
+ * openxr_enum_parse.hpp.
+ *
+ * For building flat arrays indexed by enum value, enum_values() lists the values of an enumeration that are compiled
+ * in, enum_count() counts them, and enum_index() maps a value to its position in that list in constant time.
+ *
  * They all should be accessible via argument-dependent lookup, meaning you should not need to explicitly specify the namespace.
  * @{
  */
+
+//! Implementation details
+namespace impl {
+//! Mixes a 32-bit key with a seed, for the generated perfect hash tables. Mirrors scripts/perfect_hash.py.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t perfectHashMix(uint32_t x) { return x ^ (x >> 16); }
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t perfectHash(uint32_t key, uint32_t seed) {
+    return perfectHashMix((key ^ seed) * 0x9E3779B1u);
+}
+
+//! The slot of @p key in a perfect hash table with the given seeds and @p SlotCount slots, both powers of two.
+template <size_t SlotCount, size_t SeedCount>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t perfectHashSlot(const uint16_t (&seeds)[SeedCount], uint32_t key) {
+    return perfectHash(key, seeds[perfectHash(key, 0) & (SeedCount - 1)]) & (SlotCount - 1);
+}
+
+//! A slot of a table from enum values to names: the value placed there and its name, or a null name if empty.
+struct EnumNameSlot {
+    uint32_t value;
+    const char* name;
+};
+
+//! Perfect hash table from the values of a large, sparse enum to their names, with static `seeds` and `slots`
+//! arrays whose sizes are powers of two. Specialized for each such enum.
+template <typename E, typename Dummy = void>
+struct EnumNameTable;
+
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const char* enumNameInSlot(EnumNameSlot const& slot, uint32_t value) {
+    return slot.name != nullptr && slot.value == value ? slot.name : "invalid";
+}
+
+//! Looks up the name of an enum value in its EnumNameTable: two hashes and two loads, whatever the enum's size.
+template <size_t SeedCount, size_t SlotCount>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE const char* lookupEnumName(const uint16_t (&seeds)[SeedCount],
+                                                                  const EnumNameSlot (&slots)[SlotCount], uint32_t value) {
+    return enumNameInSlot(slots[perfectHashSlot<SlotCount>(seeds, value)], value);
+}
+
+//! The eight bytes at @p str as a little-endian word, in a form that compilers turn into a single load.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint64_t loadWord(const char* str) {
+    return uint64_t(uint8_t(str[0])) | uint64_t(uint8_t(str[1])) << 8 | uint64_t(uint8_t(str[2])) << 16 |
+           uint64_t(uint8_t(str[3])) << 24 | uint64_t(uint8_t(str[4])) << 32 | uint64_t(uint8_t(str[5])) << 40 |
+           uint64_t(uint8_t(str[6])) << 48 | uint64_t(uint8_t(str[7])) << 56;
+}
+
+//! The fewer than eight bytes at @p str as a little-endian, zero-padded word, without branching on each byte.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint64_t loadPartialWord(const char* str, size_t length) {
+    return (length > 0 ? uint64_t(uint8_t(str[0])) : 0) | (length > 1 ? uint64_t(uint8_t(str[1])) << 8 : 0) |
+           (length > 2 ? uint64_t(uint8_t(str[2])) << 16 : 0) | (length > 3 ? uint64_t(uint8_t(str[3])) << 24 : 0) |
+           (length > 4 ? uint64_t(uint8_t(str[4])) << 32 : 0) | (length > 5 ? uint64_t(uint8_t(str[5])) << 40 : 0) |
+           (length > 6 ? uint64_t(uint8_t(str[6])) << 48 : 0);
+}
+
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint64_t mixNameWord(uint64_t hash, uint64_t word) {
+    return ((hash ^ word) * 0x9E3779B97F4A7C15u) ^ (((hash ^ word) * 0x9E3779B97F4A7C15u) >> 32);
+}
+
+//! The values of an enum that are compiled in, as a static `values` array in declaration order, with their `count`
+//! and a static `indexOf()` function mapping a value to its index in `values`, or to `count` if it is not there.
+//! Specialized for each enum.
+template <typename E, typename Dummy = void>
+struct EnumValueList;
+
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE size_t denseEnumIndex(uint32_t offset, size_t count) {
+    return offset < count ? offset : count;
+}
+
+//! The index in `values` of the first value of a run of values under the same guards, given how many values of
+//! each run are compiled in. Only evaluated while generating tables, so recursing is not a concern.
+template <size_t RunCount>
+inline OPENXR_HPP_CONSTEXPR size_t enumRunStart(const size_t (&runSizes)[RunCount], size_t run) {
+    return run == 0 ? 0 : enumRunStart(runSizes, run - 1) + runSizes[run - 1];
+}
+
+//! The index in `values` of a value given its run and position in that run, or @p count if its run is not compiled in.
+template <size_t RunCount>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint32_t enumIndexInRun(const size_t (&runSizes)[RunCount], size_t run,
+                                                             size_t offset, size_t count) {
+    return static_cast<uint32_t>(runSizes[run] != 0 ? enumRunStart(runSizes, run) + offset : count);
+}
+
+//! A slot of a table from enum values to their indices in `values`: the value placed there and its index, which is
+//! `count` if empty or not compiled in.
+struct EnumIndexSlot {
+    uint32_t value;
+    uint32_t index;
+};
+
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE size_t enumIndexInSlot(EnumIndexSlot const& slot, uint32_t value, size_t count) {
+    return slot.value == value ? slot.index : count;
+}
+
+//! Looks up the index of a value of a sparse enum in its EnumValueList: two hashes and two loads.
+template <size_t SeedCount, size_t SlotCount>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE size_t lookupEnumIndex(const uint16_t (&seeds)[SeedCount],
+                                                              const EnumIndexSlot (&slots)[SlotCount], uint32_t value,
+                                                              size_t count) {
+    return enumIndexInSlot(slots[perfectHashSlot<SlotCount>(seeds, value)], value, count);
+}
+}  // namespace impl
+
+//! @brief All values of enum E that are compiled in, in declaration order, as a constexpr array.
+//!
+//! Aliases are left out, as are values of extensions or platforms whose guards are not defined.
+template <typename E>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE auto enum_values() noexcept -> decltype((impl::EnumValueList<E>::values)) {
+    return impl::EnumValueList<E>::values;
+}
+
+//! @brief The number of values of enum E in enum_values(), for sizing flat arrays indexed by enum_index().
+template <typename E>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE size_t enum_count() noexcept {
+    return impl::EnumValueList<E>::count;
+}
+
+//! @brief The index of @p value in enum_values(), in constant time even for sparse enums such as StructureType and
+//! Result, or enum_count() if it is not there.
+template <typename E>
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE size_t enum_index(E value) noexcept {
+    return impl::EnumValueList<E>::indexOf(value);
+}
+
 //# for enum in gen.api_enums
 //## Note this won't actually find anything until automatic_source_generator.py is modified
 //## to actually store a value under "alias", but...
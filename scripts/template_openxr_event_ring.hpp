@@ -0,0 +1,307 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a lock-free single-producer, single-consumer ring buffer for OpenXR events.
+ *
+ * @see xr::EventRing, xr::EventView
+ * @ingroup utilities
+ */
+
+#include "openxr_structs.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+//# include('define_namespace.hpp') without context
+
+//# set event_structs = struct_children.get('XrEventDataBaseHeader', ())
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Get the size in bytes of the raw event structure identified by @p type.
+ *
+ * Types not known to this header (for example, events from a newer extension) report the size of XrEventDataBuffer,
+ * so they are never truncated.
+ *
+ * @ingroup utilities
+ */
+OPENXR_HPP_INLINE size_t eventStructSize(StructureType type) noexcept {
+    switch (type) {
+//# for struct in gen.api_structures if struct.name in event_structs
+        /*{ protect_begin(struct) }*/
+        case /*{ project_struct(struct).struct_type_enum }*/:
+            return sizeof(/*{ struct.name }*/);
+        /*{ protect_end(struct) }*/
+//# endfor
+        default:
+            return sizeof(XrEventDataBuffer);
+    }
+}
+
+namespace impl {
+    //! Bytes taken in an EventRing by an event of the given size: an 8-byte record header plus the event, rounded up to 8 bytes.
+    OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE uint64_t eventRecordSize(uint64_t eventSize) noexcept {
+        return (eventSize + 8 + 7) & ~uint64_t(7);
+    }
+}  // namespace impl
+
+namespace traits {
+    /*!
+     * @brief Type trait mapping an event structure projection to its StructureType value.
+     *
+     * Only specialized for the projections of structures derived from XrEventDataBaseHeader.
+     *
+     * @ingroup utilities
+     */
+    template <typename T>
+    struct event_type;
+
+#ifndef OPENXR_HPP_DOXYGEN
+//# for struct in gen.api_structures if struct.name in event_structs
+//#     set s = project_struct(struct)
+    /*{ protect_begin(struct) }*/
+    template <>
+    struct event_type</*{ s.cpp_name }*/> : std::integral_constant<StructureType, /*{ s.struct_type_enum }*/> {};
+    /*{ protect_end(struct) }*/
+//# endfor
+#endif  // !OPENXR_HPP_DOXYGEN
+}  // namespace traits
+
+/*!
+ * @brief A read-only view of one event stored in an EventRing.
+ *
+ * Only valid inside the visitor passed to EventRing::consume().
+ *
+ * @ingroup utilities
+ */
+class EventView {
+public:
+    EventView(XrEventDataBaseHeader const* header, size_t size) noexcept : header_(header), size_(size) {}
+
+    //! Get the structure type of the stored event.
+    StructureType type() const noexcept { return static_cast<StructureType>(header_->type); }
+
+    //! Get the number of bytes stored for this event.
+    size_t size() const noexcept { return size_; }
+
+    //! Get the stored event as a raw base header pointer.
+    XrEventDataBaseHeader const* get() const noexcept { return header_; }
+
+    //! Get the stored event as the given projection type, or nullptr if it is of a different type.
+    template <typename T>
+    T const* get_if() const noexcept {
+        return type() == traits::event_type<T>::value ? reinterpret_cast<T const*>(header_) : nullptr;
+    }
+
+    //! Copy the stored event into an EventDataBuffer, touching only the bytes the event occupies.
+    void copyTo(EventDataBuffer& buffer) const noexcept {
+        memcpy(buffer.put(false), header_, size_);
+    }
+
+private:
+    XrEventDataBaseHeader const* header_;
+    size_t size_;
+};
+
+/*!
+ * @brief A lock-free single-producer, single-consumer ring buffer of OpenXR events.
+ *
+ * Events are stored back to back at their actual structure size (see eventStructSize()),
+ * rather than as whole XrEventDataBuffer copies, so a typical event costs a few dozen bytes instead of 4 KB.
+ *
+ * One thread (usually the one calling `xrPollEvent`) may call push() or pollFrom(),
+ * and one other thread may call consume() or pop(). Neither side ever blocks or waits on the other.
+ *
+ * The `next` chain of a stored event is not preserved: it is always nullptr when read back.
+ *
+ * @tparam CapacityBytes Size of the storage in bytes: must be a power of two able to hold two full XrEventDataBuffer records.
+ *
+ * @ingroup utilities
+ */
+template <size_t CapacityBytes = 64 * 1024>
+class EventRing {
+    struct RecordHeader {
+        uint32_t size;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(RecordHeader) == 8, "Record header size must match impl::eventRecordSize");
+    static_assert((CapacityBytes & (CapacityBytes - 1)) == 0, "EventRing capacity must be a power of two");
+    static_assert(CapacityBytes >= 2 * impl::eventRecordSize(sizeof(XrEventDataBuffer)),
+                  "EventRing capacity must hold at least two full-size events");
+
+    static OPENXR_HPP_CONSTEXPR uint32_t wrapMarker = 0xffffffffu;
+    static OPENXR_HPP_CONSTEXPR uint64_t mask = CapacityBytes - 1;
+
+public:
+    EventRing() noexcept = default;
+    EventRing(EventRing const&) = delete;
+    EventRing& operator=(EventRing const&) = delete;
+
+    //! Get the storage size in bytes.
+    static OPENXR_HPP_CONSTEXPR size_t capacity() noexcept { return CapacityBytes; }
+
+    /*!
+     * @brief Copy an event into the ring. Producer thread only.
+     *
+     * Wait-free. If there is not enough free space, the event is dropped, droppedCount() is incremented, and false is returned.
+     */
+    bool push(XrEventDataBaseHeader const& event) noexcept {
+        const uint32_t size = static_cast<uint32_t>(eventStructSize(static_cast<StructureType>(event.type)));
+        const uint64_t recordSize = impl::eventRecordSize(size);
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        const uint64_t contiguous = CapacityBytes - (head & mask);
+        const uint64_t needed = recordSize + (contiguous < recordSize ? contiguous : 0);
+        if (CapacityBytes - (head - cachedTail_) < needed) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (CapacityBytes - (head - cachedTail_) < needed) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        if (contiguous < recordSize) {
+            // Not enough room before the end: mark the tail of the storage as skipped and start over at the front.
+            writeHeader(head & mask, wrapMarker);
+            head += contiguous;
+        }
+        uint8_t* record = writeHeader(head & mask, size);
+        memcpy(record, &event, size);
+        const void* nullNext = nullptr;
+        memcpy(record + offsetof(XrEventDataBaseHeader, next), &nullNext, sizeof(nullNext));
+        head_.store(head + recordSize, std::memory_order_release);
+        return true;
+    }
+
+    //! @overload
+    bool push(EventDataBuffer const& event) noexcept {
+        return push(*reinterpret_cast<XrEventDataBaseHeader const*>(event.get()));
+    }
+
+    /*!
+     * @brief Poll events from the runtime into the ring until the runtime queue is empty. Producer thread only.
+     *
+     * Stops early, without polling, once there may not be room for another full-size event,
+     * so events are left queued in the runtime rather than dropped.
+     *
+     * @return Result::EventUnavailable once drained, Result::Success if stopped early because the ring was full,
+     * or the failure returned by `xrPollEvent`.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result pollFrom(Instance instance, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) noexcept {
+        XrEventDataBuffer buffer;
+        while (CapacityBytes - (head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_acquire)) >=
+               2 * impl::eventRecordSize(sizeof(XrEventDataBuffer))) {
+            buffer.type = XR_TYPE_EVENT_DATA_BUFFER;
+            buffer.next = nullptr;
+            Result result = static_cast<Result>(d.xrPollEvent(instance.get(), &buffer));
+            if (result != Result::Success) {
+                return result;
+            }
+            push(*reinterpret_cast<XrEventDataBaseHeader const*>(&buffer));
+        }
+        return Result::Success;
+    }
+
+    /*!
+     * @brief Pass stored events, oldest first, to @p visitor as EventView. Consumer thread only.
+     *
+     * Each event is released back to the producer as soon as the visitor returns.
+     *
+     * @return the number of events visited.
+     */
+    template <typename F>
+    size_t consume(F&& visitor, size_t maxEvents = SIZE_MAX) {
+        size_t count = 0;
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        while (count < maxEvents) {
+            if (tail == cachedHead_) {
+                cachedHead_ = head_.load(std::memory_order_acquire);
+                if (tail == cachedHead_) {
+                    break;
+                }
+            }
+            RecordHeader header;
+            memcpy(&header, storage_ + (tail & mask), sizeof(header));
+            if (header.size == wrapMarker) {
+                tail += CapacityBytes - (tail & mask);
+                tail_.store(tail, std::memory_order_release);
+                continue;
+            }
+            visitor(EventView{reinterpret_cast<XrEventDataBaseHeader const*>(storage_ + (tail & mask) + sizeof(RecordHeader)),
+                              header.size});
+            tail += impl::eventRecordSize(header.size);
+            tail_.store(tail, std::memory_order_release);
+            ++count;
+        }
+        return count;
+    }
+
+    //! Copy the oldest stored event into @p buffer and release it. Consumer thread only. Returns false if the ring is empty.
+    bool pop(EventDataBuffer& buffer) noexcept {
+        return consume([&](EventView const& event) { event.copyTo(buffer); }, 1) == 1;
+    }
+
+    //! True if no events are stored. Exact only on the consumer thread.
+    bool empty() const noexcept {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_relaxed);
+    }
+
+    //! Get the number of events push() has dropped because the ring was full.
+    uint64_t droppedCount() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    uint8_t* writeHeader(uint64_t offset, uint32_t size) noexcept {
+        RecordHeader header{size, 0};
+        memcpy(storage_ + offset, &header, sizeof(header));
+        return storage_ + offset + sizeof(header);
+    }
+
+    // Producer-owned
+    alignas(64) std::atomic<uint64_t> head_{0};
+    uint64_t cachedTail_ = 0;
+    std::atomic<uint64_t> dropped_{0};
+
+    // Consumer-owned
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    uint64_t cachedHead_ = 0;
+
+    alignas(64) uint8_t storage_[CapacityBytes];
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
@@ -47,11 +47,30 @@
  * Some can even omit the Result return value entirely, if there are no particularly useful success codes besides Result::Success.
  *
  * @see OPENXR_HPP_DISABLE_ENHANCED_MODE
+ * @see OPENXR_HPP_EXPECTED
  * @see openxr_exceptions.hpp
  *
  * @ingroup config
  */
 
+/*!
+ * @def OPENXR_HPP_EXPECTED
+ * @brief Define in order to have enhanced mode calls return an xr::Expected instead of throwing.
+ *
+ * Calls that would return only their output when exceptions are enabled instead return an `Expected<T>`, which holds
+ * either the output or the error Result. Nothing is asserted, and on failure no output value is moved into the
+ * return value. Calls with other success codes, or without an output, still return a Result or ResultValue.
+ *
+ * Implies OPENXR_HPP_NO_EXCEPTIONS.
+ *
+ * @see return_results
+ *
+ * @ingroup config
+ */
+#if defined(OPENXR_HPP_EXPECTED) && !defined(OPENXR_HPP_NO_EXCEPTIONS)
+#define OPENXR_HPP_NO_EXCEPTIONS
+#endif
+
 #if !defined(OPENXR_HPP_NO_EXCEPTIONS)
 
 #include "openxr_enums.hpp"
@@ -60,27 +79,47 @@
 //# include('define_namespace.hpp') without context
 //# include('define_namespace_string.hpp') without context
 
+#include <algorithm>
+#include <cstdint>
 #include <stdexcept>
 #include <system_error>
 
 namespace OPENXR_HPP_NAMESPACE {
 
+/*!
+ * @brief Identifies an OpenXR command, so that errors can record where they came from without carrying a string.
+ *
+ * Every command has a value, whether or not its platform or extension is enabled, so the numbering does not depend
+ * on the configuration.
+ *
+ * @ingroup exceptions
+ */
+enum class CommandId : uint16_t {
+    Unknown = 0,
+    //# for cmd in sorted_cmds
+    /*{ cmd.name[2:] }*/,
+    //# endfor
+};
+
+//! @brief Free function for retrieving the name of the command identified by a CommandId, as a const char *.
+OPENXR_HPP_INLINE const char* to_string_literal(CommandId value) {
+    static const char* const names[] = {
+        "Unknown",
+        //# for cmd in sorted_cmds
+        /*{ cmd.name | quote_string }*/,
+        //# endfor
+    };
+    return static_cast<size_t>(value) < sizeof(names) / sizeof(names[0]) ? names[static_cast<size_t>(value)] : "invalid";
+}
+
 //! Implementation details
 namespace impl {
-#if defined(_MSC_VER) && (_MSC_VER == 1800)
-#define noexcept _NOEXCEPT
-#endif
-
 class ErrorCategoryImpl : public std::error_category {
    public:
     virtual const char* name() const noexcept override { return OPENXR_HPP_NAMESPACE_STRING "::Result"; }
     virtual std::string message(int ev) const override { return to_string(static_cast<Result>(ev)); }
 };
 
-#if defined(_MSC_VER) && (_MSC_VER == 1800)
-#undef noexcept
-#endif
-
 OPENXR_HPP_INLINE const std::error_category& errorCategory() {
     static impl::ErrorCategoryImpl instance;
     return instance;
@@ -92,9 +131,13 @@ OPENXR_HPP_INLINE std::error_condition make_error_condition(Result e) {
     return std::error_condition(static_cast<int>(e), errorCategory());
 }
 
-#if defined(_MSC_VER) && (_MSC_VER == 1800)
-#define noexcept _NOEXCEPT
-#endif
+//! Copies as much of a string as fits into [out, end), returning the new output position.
+inline char* appendTruncated(char* out, char* end, char const* str) noexcept {
+    while (out != end && *str != '\0') {
+        *out++ = *str++;
+    }
+    return out;
+}
 }  // namespace impl
 
 //! OpenXR exceptions
@@ -132,25 +175,52 @@ class LogicError : public Error, public std::logic_error {
 
 //! @brief OpenXR system error exception class - may be derived from or thrown directly.
 //!
-//! Derives from both Error and std::system_error for flexibility in catching.
-class SystemError : public Error, public std::system_error {
+//! Holds only the Result, a pointer to the name of the function that failed, and its CommandId, so constructing,
+//! copying and throwing one never allocates. The name must outlive the exception: the generated wrappers pass string
+//! literals. The message returned by what() is only formatted when asked for.
+//!
+//! Derives from both Error and std::exception for flexibility in catching. Use code() for a std::error_code.
+//! It no longer derives from std::system_error, so `catch (std::system_error const&)` does not catch it: catch
+//! SystemError instead.
+class SystemError : public Error, public std::exception {
    public:
-    SystemError(std::error_code ec) : Error(), std::system_error(ec) {}
-    SystemError(std::error_code ec, std::string const& what) : Error(), std::system_error(ec, what) {}
-    SystemError(std::error_code ec, char const* what) : Error(), std::system_error(ec, what) {}
-    SystemError(int ev, std::error_category const& ecat) : Error(), std::system_error(ev, ecat) {}
-    SystemError(int ev, std::error_category const& ecat, std::string const& what) : Error(), std::system_error(ev, ecat, what) {}
-    SystemError(int ev, std::error_category const& ecat, char const* what) : Error(), std::system_error(ev, ecat, what) {}
+    explicit SystemError(Result result, char const* function = nullptr, CommandId command = CommandId::Unknown) noexcept
+        : Error(), std::exception(), result_(result), function_(function), command_(command) {}
     virtual ~SystemError() = default;
 
-    virtual const char* what() const noexcept { return std::system_error::what(); }
+    //! The result code that caused this exception.
+    Result result() const noexcept { return result_; }
+    //! The result code as a std::error_code in the OpenXR error category.
+    std::error_code code() const noexcept { return impl::make_error_code(result_); }
+    //! The qualified name of the function that failed, or nullptr if unknown.
+    char const* function() const noexcept { return function_; }
+    //! The command that failed, or CommandId::Unknown.
+    CommandId command() const noexcept { return command_; }
+
+    //! @brief Returns "<function>: <result>", formatted into a thread-local buffer.
+    //!
+    //! The returned string is valid until the next call to what() on an OpenXR SystemError on the same thread.
+    virtual const char* what() const noexcept {
+        static thread_local char buffer[256];
+        char* const end = buffer + sizeof(buffer) - 1;
+        char* out = buffer;
+        if (function_ != nullptr) {
+            out = impl::appendTruncated(out, end, function_);
+            out = impl::appendTruncated(out, end, ": ");
+        }
+        out = impl::appendTruncated(out, end, to_string_literal(result_));
+        *out = '\0';
+        return buffer;
+    }
+
+   private:
+    Result result_;
+    char const* function_;
+    CommandId command_;
 };
 
 // end of base_exceptions
 //! @}
-#if defined(_MSC_VER) && (_MSC_VER == 1800)
-#undef noexcept
-#endif
 
 /*!
  * @defgroup result_exceptions Result-specific exceptions
@@ -164,11 +234,8 @@ class SystemError : public Error, public std::system_error {
 //! @brief Exception class for the Result::/*{valname}*/ aka /*{val.name}*/ result code.
 class /*{classname}*/ : public SystemError {
    public:
-    /*{classname}*/ (std::string const& message)
-        : SystemError(impl::make_error_code(Result::/*{valname}*/), message){}
-
-    /*{classname}*/ (char const* message)
-        : SystemError(impl::make_error_code(Result::/*{valname}*/), message) {}
+    explicit /*{classname}*/ (char const* function = nullptr, CommandId command = CommandId::Unknown) noexcept
+        : SystemError(Result::/*{valname}*/, function, command) {}
 };
 /*{ protect_end(val, enum) }*/
 //# endfor
@@ -176,32 +243,50 @@ class /*{classname}*/ : public SystemError {
 // end of result_exceptions
 //! @}
 
+namespace impl {
+template <typename E>
+[[noreturn]] OPENXR_HPP_NOINLINE_COLD void throwException(char const* function, CommandId command) {
+    throw E(function, command);
+}
+
+//! An error result, and how to throw the exception class for it.
+struct ResultThrower {
+    Result result;
+    void (*doThrow)(char const* function, CommandId command);
+
+    bool operator<(Result other) const noexcept { return static_cast<int32_t>(result) < static_cast<int32_t>(other); }
+};
+}  // namespace impl
+
 /*!
  * @brief Throws the best exception for a result code.
  *
- * Takes a result code and a message (usually the method triggering the exception) and throws the most-specific exception available
- * for that result code. As a fallback, it will throw a SystemError directly.
+ * Takes a result code, the name of the function that failed and optionally its CommandId, and throws the
+ * most-specific exception available for that result code. The exception class is found by a binary search over a
+ * generated table of error results, sorted by value. As a fallback, it will throw a SystemError directly.
+ *
+ * @param message Not copied: the exception keeps the pointer, and returns it from function() and uses it in what().
+ * It must therefore outlive the exception and every copy of it, so pass a string literal or other static storage,
+ * never the c_str() of a std::string that may be destroyed before the exception is caught.
+ *
+ * Kept out of line and marked cold, since it only runs on failure: the wrappers reach it through small per-command
+ * thunks and keep just a branch and a call on their success path.
  */
-OPENXR_HPP_INLINE void throwResultException(Result result, char const* message) {
-    switch (result) {
-        //# for val in result_enum.values
-        /*{ protect_begin(val, enum) }*/
-        //#     set valname = create_enum_value(val.name, 'XrResult')
-        case Result::/*{valname}*/:
-            //# if "XR_ERROR" in val.name
-            //#     set classname = create_enum_exception(val.name)
-            throw /*{classname}*/ (message);
-            //# else
-            // Not actually an error!
-            throw SystemError(impl::make_error_code(result));
-            //# endif
-            /*{ protect_end(val, enum) }*/
-
-            //# endfor
-
-        default:
-            throw SystemError(impl::make_error_code(result));
+[[noreturn]] OPENXR_HPP_NOINLINE_COLD inline void throwResultException(Result result, char const* message,
+                                                                      CommandId command = CommandId::Unknown) {
+    static const impl::ResultThrower throwers[] = {
+        //# for val in sorted_enum_values(result_enum) if "XR_ERROR" in val.name
+        /*{ protect_begin(val, result_enum) }*/
+        {Result::/*{ create_enum_value(val.name, 'XrResult') }*/, &impl::throwException</*{ create_enum_exception(val.name) }*/>},
+        /*{ protect_end(val, result_enum) }*/
+        //# endfor
+    };
+    const impl::ResultThrower* const end = throwers + sizeof(throwers) / sizeof(throwers[0]);
+    const impl::ResultThrower* const found = std::lower_bound(throwers, end, result);
+    if (found != end && found->result == result) {
+        found->doThrow(message, command);
     }
+    throw SystemError(result, message, command);
 }
 //! @}
 }  // namespace exceptions
@@ -47,6 +47,22 @@
 
 //# include('defines.hpp') without context
 
+#include "openxr_enums.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+#if defined(__has_include) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#if __has_include(<bit>)
+#include <bit>
+#if defined(__cpp_lib_bitops)
+#define OPENXR_HPP_HAS_BITOPS
+#endif
+#endif
+#endif
+
 //# include('nongenerated_flags.hpp') without context
 
 namespace OPENXR_HPP_NAMESPACE {
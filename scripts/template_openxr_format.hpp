@@ -0,0 +1,525 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains allocation-free text formatting of all projected types into caller buffers.
+ *
+ * Also provides `std::formatter` specializations when `<format>` is available, and `fmt::formatter` specializations
+ * when `OPENXR_HPP_FMT` is defined.
+ *
+ * @see xr::format_to
+ * @ingroup utilities
+ */
+
+#include "openxr_structs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if defined(__has_include) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#if __has_include(<charconv>)
+#include <charconv>
+#if defined(__cpp_lib_to_chars)
+#define OPENXR_HPP_HAS_TO_CHARS
+#endif
+#endif
+#endif
+
+#if defined(__has_include) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#if __has_include(<format>)
+#include <format>
+#if defined(__cpp_lib_format)
+#define OPENXR_HPP_HAS_STD_FORMAT
+#endif
+#endif
+#endif
+
+#ifdef OPENXR_HPP_FMT
+#include <fmt/format.h>
+#endif
+
+//# include('define_inline_constexpr.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+//! Implementation details
+namespace impl {
+
+/*!
+ * @brief Appends text to a fixed buffer, counting everything appended even once it is full.
+ *
+ * Without a flush function, text past the end of the buffer is dropped, as by `snprintf`. With one, a full buffer is
+ * handed to it and reused, so that text of any length passes through a small buffer on the stack.
+ */
+class FormatWriter {
+   public:
+    using FlushFunction = void (*)(void* context, const char* data, size_t size);
+
+    FormatWriter(char* buffer, size_t capacity, FlushFunction flush = nullptr, void* context = nullptr) noexcept
+        : m_buffer(buffer), m_capacity(capacity), m_used(0), m_length(0), m_flush(flush), m_context(context) {}
+
+    void append(const char* data, size_t size) noexcept {
+        m_length += size;
+        for (;;) {
+            size_t chunk = size < m_capacity - m_used ? size : m_capacity - m_used;
+            if (chunk != 0) {
+                memcpy(m_buffer + m_used, data, chunk);
+                m_used += chunk;
+            }
+            if (chunk == size || m_flush == nullptr) {
+                return;
+            }
+            flush();
+            data += chunk;
+            size -= chunk;
+        }
+    }
+
+    //! Appends a string literal, whose length is known at compile time.
+    template <size_t N>
+    void append(const char (&text)[N]) noexcept {
+        append(text, N - 1);
+    }
+
+    void appendString(const char* text) noexcept { append(text, strlen(text)); }
+
+    void put(char c) noexcept {
+        if (m_used < m_capacity) {
+            m_buffer[m_used++] = c;
+            ++m_length;
+        } else {
+            append(&c, 1);
+        }
+    }
+
+    //! Hands the buffered text to the flush function, if any.
+    void flush() noexcept {
+        if (m_flush != nullptr && m_used != 0) {
+            m_flush(m_context, m_buffer, m_used);
+            m_used = 0;
+        }
+    }
+
+    //! The number of characters in the buffer.
+    size_t used() const noexcept { return m_used; }
+
+    //! The number of characters appended in total, including any dropped or flushed.
+    size_t length() const noexcept { return m_length; }
+
+   private:
+    char* m_buffer;
+    size_t m_capacity;
+    size_t m_used;
+    size_t m_length;
+    FlushFunction m_flush;
+    void* m_context;
+};
+
+inline void formatUnsigned(FormatWriter& out, uint64_t value) noexcept {
+    char digits[20];
+    char* first = digits + sizeof(digits);
+    do {
+        *--first = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    out.append(first, static_cast<size_t>(digits + sizeof(digits) - first));
+}
+
+inline void formatSigned(FormatWriter& out, int64_t value) noexcept {
+    if (value < 0) {
+        out.put('-');
+        // Negated as unsigned, so that the most negative value does not overflow.
+        formatUnsigned(out, ~static_cast<uint64_t>(value) + 1);
+    } else {
+        formatUnsigned(out, static_cast<uint64_t>(value));
+    }
+}
+
+inline void formatHex(FormatWriter& out, uint64_t value) noexcept {
+    char digits[18];
+    char* first = digits + sizeof(digits);
+    do {
+        *--first = "0123456789abcdef"[value & 0xf];
+        value >>= 4;
+    } while (value != 0);
+    *--first = 'x';
+    *--first = '0';
+    out.append(first, static_cast<size_t>(digits + sizeof(digits) - first));
+}
+
+//! Formats the shortest text that reads back as the same value where `std::to_chars` supports floating point, and
+//! enough digits to do so otherwise.
+template <typename T>
+void formatFloatingPoint(FormatWriter& out, T value, int precision) noexcept {
+    char text[32];
+#if defined(OPENXR_HPP_HAS_TO_CHARS)
+    (void)precision;
+    std::to_chars_result result = std::to_chars(text, text + sizeof(text), value);
+    out.append(text, static_cast<size_t>(result.ptr - text));
+#else
+    int length = snprintf(text, sizeof(text), "%.*g", precision, static_cast<double>(value));
+    out.append(text, length < 0 ? 0 : static_cast<size_t>(length));
+#endif
+}
+
+/*!
+ * @defgroup formatting Formatting
+ * @brief Overloads of `formatValue()` for each formatted type, found by argument-dependent lookup on FormatWriter.
+ * @{
+ */
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type formatValue(FormatWriter& out,
+                                                                                                  T value) noexcept {
+    formatSigned(out, value);
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type formatValue(FormatWriter& out,
+                                                                                                   T value) noexcept {
+    formatUnsigned(out, value);
+}
+
+inline void formatValue(FormatWriter& out, float value) noexcept { formatFloatingPoint(out, value, 9); }
+
+inline void formatValue(FormatWriter& out, double value) noexcept { formatFloatingPoint(out, value, 17); }
+
+//! A fixed-size string member, quoted, up to its terminator or its size.
+template <size_t N>
+void formatValue(FormatWriter& out, const char (&text)[N]) noexcept {
+    out.put('"');
+    out.append(text, strnlen(text, N));
+    out.put('"');
+}
+
+//! A null-terminated input string, quoted.
+inline void formatPointer(FormatWriter& out, const char* text) noexcept {
+    out.put('"');
+    out.appendString(text);
+    out.put('"');
+}
+
+//! Any other pointer, as its address: what it points to may be a buffer of unknown size.
+template <typename T>
+void formatPointer(FormatWriter& out, T* pointer) noexcept {
+    formatHex(out, reinterpret_cast<uintptr_t>(pointer));
+}
+
+//! Taken by reference, so that arrays are not converted to pointers and are formatted by element instead.
+template <typename T>
+void formatValue(FormatWriter& out, T* const& pointer) noexcept {
+    if (pointer == nullptr) {
+        out.append("null");
+    } else {
+        formatPointer(out, pointer);
+    }
+}
+
+template <typename T>
+auto formatMember(FormatWriter& out, T const& value, int) noexcept -> decltype(formatValue(out, value)) {
+    formatValue(out, value);
+}
+
+//! Fallback for members of platform types, such as `LUID`, that have no formatting of their own.
+template <typename T>
+void formatMember(FormatWriter& out, T const&, long) noexcept {
+    out.put('?');
+}
+
+template <typename T, size_t N>
+void formatValue(FormatWriter& out, T const (&values)[N]) noexcept {
+    out.put('[');
+    for (size_t i = 0; i < N; ++i) {
+        if (i != 0) {
+            out.append(", ");
+        }
+        formatMember(out, values[i], 0);
+    }
+    out.put(']');
+}
+
+//! An enum value by name, or by number if it has none.
+template <typename E>
+auto formatEnum(FormatWriter& out, E value, int) noexcept -> decltype(EnumValueList<E>::count, void()) {
+    if (enum_index(value) != enum_count<E>()) {
+        out.appendString(to_string_literal(value));
+    } else {
+        formatSigned(out, static_cast<int64_t>(value));
+    }
+}
+
+//! The names of the set bits of a flag bits value, separated by " | ", with bits that have no name in hex.
+template <typename E>
+auto formatEnum(FormatWriter& out, E value, int) noexcept -> decltype(FlagBitNames<E>::names, void()) {
+    const auto& names = FlagBitNames<E>::names;
+    uint64_t remaining = static_cast<uint64_t>(value);
+    if (remaining == 0) {
+        out.append("None");
+        return;
+    }
+    for (bool first = true; remaining != 0; first = false) {
+        uint64_t bit = remaining & (~remaining + 1);
+        remaining &= remaining - 1;
+        if (!first) {
+            out.append(" | ");
+        }
+        uint32_t position = countTrailingZeros(bit);
+        if (position < sizeof(names) / sizeof(names[0]) && names[position] != nullptr) {
+            out.appendString(names[position]);
+        } else {
+            formatHex(out, bit);
+        }
+    }
+}
+
+//! Enums of platform headers, by number.
+template <typename E>
+void formatEnum(FormatWriter& out, E value, long) noexcept {
+    formatSigned(out, static_cast<int64_t>(value));
+}
+
+template <typename E>
+typename std::enable_if<std::is_enum<E>::value>::type formatValue(FormatWriter& out, E value) noexcept {
+    formatEnum(out, value, 0);
+}
+
+template <typename BitType, typename MaskType>
+void formatValue(FormatWriter& out, Flags<BitType, MaskType> const& flags) noexcept {
+    formatEnum(out, static_cast<BitType>(flags.get()), 0);
+}
+
+inline void formatValue(FormatWriter& out, Bool32 const& value) noexcept {
+    if (value.get() != XR_FALSE) {
+        out.append("true");
+    } else {
+        out.append("false");
+    }
+}
+
+//! Nanoseconds.
+inline void formatValue(FormatWriter& out, Time const& value) noexcept { formatSigned(out, value.get()); }
+
+//! Nanoseconds.
+inline void formatValue(FormatWriter& out, Duration const& value) noexcept { formatSigned(out, value.get()); }
+
+//! As "major.minor.patch".
+inline void formatValue(FormatWriter& out, Version const& value) noexcept {
+    formatUnsigned(out, value.major());
+    out.put('.');
+    formatUnsigned(out, value.minor());
+    out.put('.');
+    formatUnsigned(out, value.patch());
+}
+
+//## Atoms and handles are opaque, so they are written as hex, like the raw handles that are pointers.
+//# for raw_type in gen.dict_atoms.keys()
+inline void formatValue(FormatWriter& out, /*{ project_type_name(raw_type) }*/ const& value) noexcept { formatHex(out, value.get()); }
+//# endfor
+
+inline void formatRawHandle(FormatWriter& out, uint64_t handle) noexcept { formatHex(out, handle); }
+
+template <typename T>
+void formatRawHandle(FormatWriter& out, T* handle) noexcept {
+    formatHex(out, reinterpret_cast<uintptr_t>(handle));
+}
+
+//# for handle in gen.api_handles
+/*{ protect_begin(handle) }*/
+inline void formatValue(FormatWriter& out, /*{ project_type_name(handle.name) }*/ const& value) noexcept {
+    formatRawHandle(out, value.get());
+}
+/*{ protect_end(handle) }*/
+//# endfor
+
+inline void formatValue(FormatWriter& out, EventDataBuffer const& value) noexcept {
+    out.append("{type: ");
+    formatValue(out, value.type);
+    out.put('}');
+}
+
+//## Declared first, since structs contain other structs.
+//# for struct in gen.api_structures if struct.name not in manually_projected
+/*{ protect_begin(struct) }*/
+inline void formatValue(FormatWriter& out, /*{ project_type_name(struct.name) }*/ const& value) noexcept;
+/*{ protect_end(struct) }*/
+//# endfor
+
+//# for struct in gen.api_structures if struct.name not in manually_projected
+//#     set s = project_struct(struct)
+//#     set members = struct.members | reject('cpp_hidden_member') | list
+//#     if s.is_abstract
+//#         set members = [struct.members[0]] + members
+//#     endif
+/*{ protect_begin(struct) }*/
+inline void formatValue(FormatWriter& out, /*{ s.cpp_name }*/ const& value) noexcept {
+//#     for member in members
+    out.append(/*{ (("{" if loop.first else ", ") ~ member.name ~ ": ") | quote_string }*/);
+    formatMember(out, value./*{ member.name }*/, 0);
+//#     endfor
+    out.append(/*{ ("}" if members else "{}") | quote_string }*/);
+}
+/*{ protect_end(struct) }*/
+//# endfor
+
+//! @}
+
+template <typename T, typename = void>
+struct HasFormatValue : std::false_type {};
+
+template <typename T>
+struct HasFormatValue<T, decltype(formatValue(std::declval<FormatWriter&>(), std::declval<T const&>()))> : std::true_type {};
+
+template <typename T, typename = void>
+struct HasValueNames : std::false_type {};
+
+template <typename T>
+struct HasValueNames<T, decltype(EnumValueList<T>::count, void())> : std::true_type {};
+
+template <typename T>
+struct HasValueNames<T, decltype(FlagBitNames<T>::names, void())> : std::true_type {};
+
+//! Whether T is one of the projected types that `std::formatter` and `fmt::formatter` are specialized for.
+template <typename T>
+struct IsFormattable
+    : std::integral_constant<bool, (std::is_class<T>::value && HasFormatValue<T>::value) || HasValueNames<T>::value> {};
+
+//! Flush function for formatting into an output iterator, given the address of the iterator as context.
+template <typename OutputIt>
+void flushToIterator(void* context, const char* data, size_t size) {
+    OutputIt& it = *static_cast<OutputIt*>(context);
+    for (size_t i = 0; i < size; ++i) {
+        *it++ = data[i];
+    }
+}
+
+//! Formats @p value through a buffer on the stack into an output iterator.
+template <typename OutputIt, typename T>
+OutputIt formatToIterator(OutputIt it, T const& value) {
+    char buffer[256];
+    FormatWriter out(buffer, sizeof(buffer), &flushToIterator<OutputIt>, &it);
+    formatValue(out, value);
+    out.flush();
+    return it;
+}
+
+}  // namespace impl
+
+/*!
+ * @brief Formats @p value into @p buffer as text, field by field for structs, without allocating.
+ *
+ * Enum values are written by name, flags as their bit names separated by " | ", atoms, handles and pointers in hex,
+ * Time and Duration in nanoseconds, and fixed-size strings quoted. The `type` and `next` members of typed structs are
+ * left out, except for the `type` of abstract base structs.
+ *
+ * Like `snprintf`, the text is truncated to fit, always null-terminated when @p size is not zero, and the return value
+ * is the length of the whole text: pass a null buffer and zero size to measure it.
+ *
+ * @code
+ * char text[256];
+ * xr::format_to(text, sizeof(text), location.pose);  // {orientation: {x: 0, y: 0, z: 0, w: 1}, position: {...}}
+ * @endcode
+ *
+ * @ingroup utilities
+ */
+template <typename T>
+OPENXR_HPP_INLINE auto format_to(char* buffer, size_t size, T const& value) noexcept
+    -> decltype(formatValue(std::declval<impl::FormatWriter&>(), value), size_t()) {
+    impl::FormatWriter out(buffer, size != 0 ? size - 1 : 0);
+    formatValue(out, value);
+    if (size != 0) {
+        buffer[out.used()] = '\0';
+    }
+    return out.length();
+}
+
+//! @brief Formats @p value into a character array, as by format_to(char*, size_t, T const&).
+//! @ingroup utilities
+template <size_t N, typename T>
+OPENXR_HPP_INLINE auto format_to(char (&buffer)[N], T const& value) noexcept
+    -> decltype(formatValue(std::declval<impl::FormatWriter&>(), value), size_t()) {
+    return format_to(static_cast<char*>(buffer), N, value);
+}
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+#if defined(OPENXR_HPP_HAS_STD_FORMAT)
+namespace std {
+//! Formats projected types with `std::format`, as by xr::format_to(). No format specification is accepted.
+template <typename T>
+    requires OPENXR_HPP_NAMESPACE::impl::IsFormattable<T>::value
+struct formatter<T, char> {
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto it = ctx.begin();
+        if (it != ctx.end() && *it != '}') {
+            throw std::format_error("OpenXR types take no format specification");
+        }
+        return it;
+    }
+
+    template <typename FormatContext>
+    auto format(T const& value, FormatContext& ctx) const {
+        return OPENXR_HPP_NAMESPACE::impl::formatToIterator(ctx.out(), value);
+    }
+};
+}  // namespace std
+#endif  // OPENXR_HPP_HAS_STD_FORMAT
+
+#ifdef OPENXR_HPP_FMT
+namespace fmt {
+//! Formats projected types with the fmt library, as by xr::format_to(). No format specification is accepted.
+template <typename T>
+struct formatter<T, char, typename std::enable_if<OPENXR_HPP_NAMESPACE::impl::IsFormattable<T>::value>::type> {
+    template <typename ParseContext>
+    FMT_CONSTEXPR auto parse(ParseContext& ctx) -> decltype(ctx.begin()) {
+        auto it = ctx.begin();
+        if (it != ctx.end() && *it != '}') {
+            FMT_THROW(fmt::format_error("OpenXR types take no format specification"));
+        }
+        return it;
+    }
+
+    template <typename FormatContext>
+    auto format(T const& value, FormatContext& ctx) const -> decltype(ctx.out()) {
+        return OPENXR_HPP_NAMESPACE::impl::formatToIterator(ctx.out(), value);
+    }
+};
+}  // namespace fmt
+#endif  // OPENXR_HPP_FMT
+
+//# include('file_footer.hpp')
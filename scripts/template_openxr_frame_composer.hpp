@@ -0,0 +1,221 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains persistent, allocation-free storage for the composition layers submitted each frame.
+ *
+ * @see xr::FrameComposer
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+#include "openxr_structs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+//# include('define_assert.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Holds the composition layers for Session::endFrame() in fixed storage that persists across frames.
+ *
+ * Add layers once. Then each frame, update only what changed (typically the view poses and fields of view) through
+ * the returned references, and submit with frameEndInfo() or endFrame(). All internal pointers (the layer list, each
+ * projection layer's views, and any depth-info chains) are set up when layers are added or enabled, so
+ * steady-state frames do no allocation and no pointer fix-ups.
+ *
+ * The composer refers to itself, so it can be neither copied nor moved.
+ *
+ * @tparam MaxLayers Maximum number of layers.
+ * @tparam MaxViews Maximum number of views per projection layer.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t MaxLayers = 16, uint32_t MaxViews = 2>
+class FrameComposer {
+   public:
+    FrameComposer() = default;
+    FrameComposer(FrameComposer const&) = delete;
+    FrameComposer& operator=(FrameComposer const&) = delete;
+
+    //! Add a projection layer with @p viewCount views, returning its index. Layers are composited in the order added.
+    uint32_t addProjectionLayer(Space space, uint32_t viewCount, CompositionLayerFlags layerFlags = CompositionLayerFlags{}) {
+        OPENXR_HPP_ASSERT(layerCount_ < MaxLayers && viewCount <= MaxViews);
+        const uint32_t layer = layerCount_++;
+        CompositionLayerProjection& projection = projections_[layer];
+        projection = CompositionLayerProjection{layerFlags, space, viewCount, projectionViews_[layer]};
+        // Views and depth info left by a layer cleared from this index must not be chained to the new one.
+        for (uint32_t view = 0; view < MaxViews; ++view) {
+            projectionViews_[layer][view] = CompositionLayerProjectionView{};
+#if defined(XR_KHR_composition_layer_depth)
+            depthInfos_[layer][view] = CompositionLayerDepthInfoKHR{};
+#endif  // defined(XR_KHR_composition_layer_depth)
+        }
+        kinds_[layer] = Kind::Projection;
+        enable(layer, true);
+        return layer;
+    }
+
+    //! Add a quad layer, returning its index. Fill in the rest with quadLayer().
+    uint32_t addQuadLayer(Space space, EyeVisibility eyeVisibility = EyeVisibility::Both,
+                          CompositionLayerFlags layerFlags = CompositionLayerFlags{}) {
+        OPENXR_HPP_ASSERT(layerCount_ < MaxLayers);
+        const uint32_t layer = layerCount_++;
+        CompositionLayerQuad& quad = quads_[layer];
+        quad = CompositionLayerQuad{};
+        quad.layerFlags = layerFlags;
+        quad.space = space;
+        quad.eyeVisibility = eyeVisibility;
+        kinds_[layer] = Kind::Quad;
+        enable(layer, true);
+        return layer;
+    }
+
+    //! The projection layer at index @p layer, for changing its space or flags.
+    CompositionLayerProjection& projectionLayer(uint32_t layer) noexcept {
+        OPENXR_HPP_ASSERT(layer < layerCount_ && kinds_[layer] == Kind::Projection);
+        return projections_[layer];
+    }
+
+    //! View @p view of the projection layer at index @p layer: update its pose, fov and subImage each frame.
+    CompositionLayerProjectionView& projectionView(uint32_t layer, uint32_t view) noexcept {
+        OPENXR_HPP_ASSERT(layer < layerCount_ && kinds_[layer] == Kind::Projection && view < projections_[layer].viewCount);
+        return projectionViews_[layer][view];
+    }
+
+    //! The quad layer at index @p layer.
+    CompositionLayerQuad& quadLayer(uint32_t layer) noexcept {
+        OPENXR_HPP_ASSERT(layer < layerCount_ && kinds_[layer] == Kind::Quad);
+        return quads_[layer];
+    }
+
+#if defined(XR_KHR_composition_layer_depth)
+    /*!
+     * @brief Depth information for view @p view of the projection layer at index @p layer.
+     *
+     * The first call chains it to the view, replacing that view's `next` pointer.
+     * Requires the XR_KHR_composition_layer_depth extension to be enabled.
+     */
+    CompositionLayerDepthInfoKHR& depthInfo(uint32_t layer, uint32_t view) noexcept {
+        CompositionLayerProjectionView& projectionView = this->projectionView(layer, view);
+        CompositionLayerDepthInfoKHR& depth = depthInfos_[layer][view];
+        projectionView.next = depth.get();
+        return depth;
+    }
+#endif  // defined(XR_KHR_composition_layer_depth)
+
+    //! Include or skip the layer at index @p layer in subsequent frames, keeping its contents.
+    void setLayerEnabled(uint32_t layer, bool enabled) noexcept {
+        OPENXR_HPP_ASSERT(layer < layerCount_);
+        enable(layer, enabled);
+    }
+
+    //! Remove all layers. Layers added afterwards start from fresh views, without depth info.
+    void clear() noexcept {
+        layerCount_ = 0;
+        enabledMask_ = 0;
+        submitCount_ = 0;
+    }
+
+    //! Number of layers that will be submitted.
+    uint32_t enabledLayerCount() const noexcept { return submitCount_; }
+
+    //! The FrameEndInfo to pass to Session::endFrame(), pointing at this composer's layers.
+    FrameEndInfo const& frameEndInfo(Time displayTime, EnvironmentBlendMode environmentBlendMode) noexcept {
+        frameEndInfo_.displayTime = displayTime;
+        frameEndInfo_.environmentBlendMode = environmentBlendMode;
+        frameEndInfo_.layerCount = submitCount_;
+        frameEndInfo_.layers = submitCount_ == 0 ? nullptr : submitted_;
+        return frameEndInfo_;
+    }
+
+    /*!
+     * @brief Submit the enabled layers with `xrEndFrame`.
+     *
+     * Same as `session.endFrame(frameEndInfo(displayTime, environmentBlendMode))`, except that it returns the result
+     * instead of throwing, whatever the error-handling mode.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result endFrame(Session session, Time displayTime, EnvironmentBlendMode environmentBlendMode,
+                    Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) noexcept {
+        return static_cast<Result>(d.xrEndFrame(session.get(), frameEndInfo(displayTime, environmentBlendMode).get()));
+    }
+
+   private:
+    enum class Kind : uint8_t { Projection, Quad };
+
+    CompositionLayerBaseHeader const* header(uint32_t layer) const noexcept {
+        return kinds_[layer] == Kind::Projection ? static_cast<CompositionLayerBaseHeader const*>(&projections_[layer])
+                                                 : static_cast<CompositionLayerBaseHeader const*>(&quads_[layer]);
+    }
+
+    // Rebuild the submitted list, which only happens when the set of enabled layers changes.
+    void enable(uint32_t layer, bool enabled) noexcept {
+        const uint32_t bit = uint32_t(1) << layer;
+        const uint32_t mask = enabled ? (enabledMask_ | bit) : (enabledMask_ & ~bit);
+        if (mask == enabledMask_) {
+            return;
+        }
+        enabledMask_ = mask;
+        submitCount_ = 0;
+        for (uint32_t i = 0; i < layerCount_; ++i) {
+            if ((enabledMask_ >> i) & 1u) {
+                submitted_[submitCount_++] = header(i);
+            }
+        }
+    }
+
+    static_assert(MaxLayers <= 32, "Enabled layers are tracked in a 32-bit mask");
+
+    CompositionLayerProjection projections_[MaxLayers];
+    CompositionLayerProjectionView projectionViews_[MaxLayers][MaxViews];
+#if defined(XR_KHR_composition_layer_depth)
+    CompositionLayerDepthInfoKHR depthInfos_[MaxLayers][MaxViews];
+#endif  // defined(XR_KHR_composition_layer_depth)
+    CompositionLayerQuad quads_[MaxLayers];
+    Kind kinds_[MaxLayers] = {};
+    CompositionLayerBaseHeader const* submitted_[MaxLayers] = {};
+    FrameEndInfo frameEndInfo_;
+    uint32_t layerCount_ = 0;
+    uint32_t submitCount_ = 0;
+    uint32_t enabledMask_ = 0;
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
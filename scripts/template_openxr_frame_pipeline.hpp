@@ -0,0 +1,306 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a frame loop helper that runs Session::waitFrame() on its own pacing thread.
+ *
+ * @see xr::FramePipeline, xr::TripleBuffer
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+#include "openxr_structs.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+//# include('define_assert.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Lock-free hand-off of the latest value from one producer thread to one consumer thread.
+ *
+ * The producer fills writeBuffer() and calls publish(). The consumer calls update() and, if it returns true, reads the
+ * newest published value from readBuffer(). Neither side ever waits for the other: values the consumer does not pick
+ * up in time are overwritten by newer ones.
+ *
+ * @ingroup utilities
+ */
+template <typename T>
+class TripleBuffer {
+   public:
+    //! Producer: the buffer to fill before the next publish().
+    T& writeBuffer() noexcept { return buffers_[writeIndex_]; }
+
+    //! Producer: make the contents of writeBuffer() the newest value.
+    void publish() noexcept {
+        const uint8_t previous = state_.exchange(static_cast<uint8_t>(writeIndex_ | Fresh), std::memory_order_acq_rel);
+        writeIndex_ = previous & IndexMask;
+    }
+
+    //! True if a value has been published since the consumer's last update(). May be called from any thread.
+    bool hasUpdate() const noexcept { return (state_.load(std::memory_order_acquire) & Fresh) != 0; }
+
+    //! Consumer: switch readBuffer() to the newest value, returning false if nothing new was published.
+    bool update() noexcept {
+        if (!hasUpdate()) {
+            return false;
+        }
+        const uint8_t previous = state_.exchange(readIndex_, std::memory_order_acq_rel);
+        readIndex_ = previous & IndexMask;
+        return true;
+    }
+
+    //! Consumer: the value selected by the last successful update().
+    T const& readBuffer() const noexcept { return buffers_[readIndex_]; }
+
+   private:
+    static constexpr uint8_t IndexMask = 0x3;
+    static constexpr uint8_t Fresh = 0x4;
+
+    T buffers_[3] = {};
+    // Index of the buffer between producer and consumer, plus the Fresh bit.
+    std::atomic<uint8_t> state_{1};
+    uint8_t writeIndex_ = 0;
+    uint8_t readIndex_ = 2;
+};
+
+/*!
+ * @brief A frame produced by FramePipeline: the result of one `xrWaitFrame` call.
+ *
+ * @ingroup utilities
+ */
+struct PipelinedFrame {
+    //! Sequence number of this frame, starting at 1 after each FramePipeline::start().
+    uint64_t index = 0;
+    //! The predicted display time and period, and whether to render.
+    FrameState state;
+};
+
+/*!
+ * @brief Runs `xrWaitFrame` on a dedicated pacing thread, so that simulation and rendering never block in it.
+ *
+ * After start(), the pacing thread waits for each frame and publishes its PipelinedFrame through a TripleBuffer.
+ * A typical pipeline uses two more threads:
+ *
+ * - The simulation thread calls acquireFrame() to get frame N, and simulates for its predicted display time.
+ * - The render thread calls beginFrame() for frame N, records and submits its work, then calls endFrame().
+ *
+ * As soon as frame N has begun, the pacing thread starts waiting for frame N+1. Simulation of frame N+1 therefore
+ * overlaps with rendering and `xrEndFrame` of frame N.
+ *
+ * The pipeline follows the OpenXR ordering rules. `xrWaitFrame` is only ever called from the pacing thread. It is not
+ * called again until the previous frame has begun, so no waited frame is dropped. Frames must be passed to
+ * beginFrame() in the order they were acquired. beginFrame() and endFrame() must be externally synchronized with each
+ * other, as for the underlying calls.
+ *
+ * The dispatch is copied and used from the pacing thread.
+ *
+ * @ingroup utilities
+ */
+template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG>
+class FramePipeline {
+    static_assert(traits::is_dispatch<Dispatch>::value, "Dispatch must be a dispatch type");
+
+   public:
+    //! Prepare to pace frames of @p session. Call start() to launch the pacing thread.
+    explicit FramePipeline(Session session, Dispatch const& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG)
+        : session_(session), d_(d) {}
+
+    FramePipeline(FramePipeline const&) = delete;
+    FramePipeline& operator=(FramePipeline const&) = delete;
+
+    //! Stops the pacing thread if it is running.
+    ~FramePipeline() { stop(); }
+
+    //! Launch the pacing thread, once the session is running. Frame indices restart at 1.
+    void start() {
+        OPENXR_HPP_ASSERT(!pacer_.joinable());
+        waited_.store(0, std::memory_order_relaxed);
+        begun_.store(0, std::memory_order_relaxed);
+        ended_ = 0;
+        stopping_ = false;
+        stopped_.store(false, std::memory_order_relaxed);
+        waitResult_ = Result::Success;
+        // Drop any frame left over from a previous run.
+        frames_.update();
+        pacer_ = std::thread([this] { pace(); });
+    }
+
+    /*!
+     * @brief Stop and join the pacing thread, and wake any thread blocked in acquireFrame().
+     *
+     * Call this before Session::endSession(). If the pacing thread is inside `xrWaitFrame`, this waits for that call to
+     * return.
+     */
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        changed_.notify_all();
+        if (pacer_.joinable()) {
+            pacer_.join();
+        }
+    }
+
+    /*!
+     * @brief Get the next frame without blocking.
+     *
+     * Returns false if the pacing thread has not finished waiting for a frame after the last one acquired.
+     */
+    bool tryAcquireFrame(PipelinedFrame& frame) noexcept {
+        if (!frames_.update()) {
+            return false;
+        }
+        frame = frames_.readBuffer();
+        return true;
+    }
+
+    /*!
+     * @brief Block until the next frame is available.
+     *
+     * Returns false before start(), once the pipeline is stopped, or after `xrWaitFrame` fails. In the latter case,
+     * waitResult() has the error.
+     */
+    bool acquireFrame(PipelinedFrame& frame) {
+        if (tryAcquireFrame(frame)) {
+            return true;
+        }
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            changed_.wait(lock, [this] { return frames_.hasUpdate() || stopped_.load(std::memory_order_relaxed); });
+        }
+        return tryAcquireFrame(frame);
+    }
+
+    /*!
+     * @brief Call `xrBeginFrame` for @p frame, which lets the pacing thread wait for the following frame.
+     *
+     * Frames must begin in order and may not be skipped. Returns the result of `xrBeginFrame`.
+     */
+    Result beginFrame(PipelinedFrame const& frame) noexcept {
+        OPENXR_HPP_ASSERT(frame.index == begun_.load(std::memory_order_relaxed) + 1);
+        XrFrameBeginInfo beginInfo{};
+        beginInfo.type = XR_TYPE_FRAME_BEGIN_INFO;
+        const Result result = static_cast<Result>(d_.xrBeginFrame(session_.get(), &beginInfo));
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            begun_.store(frame.index, std::memory_order_relaxed);
+        }
+        changed_.notify_all();
+        return result;
+    }
+
+    //! Call `xrEndFrame` for @p frame, which must be the frame most recently begun. Returns its result.
+    Result endFrame(PipelinedFrame const& frame, FrameEndInfo const& frameEndInfo) noexcept {
+        OPENXR_HPP_ASSERT(frame.index == begun_.load(std::memory_order_relaxed) && frame.index > ended_);
+        ended_ = frame.index;
+        return static_cast<Result>(d_.xrEndFrame(session_.get(), frameEndInfo.get()));
+    }
+
+    //! Number of frames the pacing thread has finished waiting for since start().
+    uint64_t waitedFrameCount() const noexcept { return waited_.load(std::memory_order_acquire); }
+
+    //! True before start(), and once the pacing thread has exited because of stop() or a failed `xrWaitFrame`. No more
+    //! frames will arrive until the next start().
+    bool stopped() const noexcept { return stopped_.load(std::memory_order_acquire); }
+
+    //! Success, or the error that stopped the pacing thread. Valid once stopped() returns true.
+    Result waitResult() const noexcept { return waitResult_; }
+
+   private:
+    void pace() {
+        for (;;) {
+            {
+                // Wait for the previous frame to begin, so that no waited frame is dropped.
+                std::unique_lock<std::mutex> lock(mutex_);
+                changed_.wait(lock, [this] {
+                    return stopping_ || begun_.load(std::memory_order_relaxed) == waited_.load(std::memory_order_relaxed);
+                });
+                if (stopping_) {
+                    break;
+                }
+            }
+            XrFrameWaitInfo waitInfo{};
+            waitInfo.type = XR_TYPE_FRAME_WAIT_INFO;
+            PipelinedFrame& frame = frames_.writeBuffer();
+            const Result result = static_cast<Result>(d_.xrWaitFrame(session_.get(), &waitInfo, frame.state.put()));
+            if (failed(result)) {
+                waitResult_ = result;
+                break;
+            }
+            frame.index = waited_.load(std::memory_order_relaxed) + 1;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                frames_.publish();
+                waited_.store(frame.index, std::memory_order_release);
+            }
+            changed_.notify_all();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_.store(true, std::memory_order_release);
+        }
+        changed_.notify_all();
+    }
+
+    Session session_;
+    Dispatch d_;
+    TripleBuffer<PipelinedFrame> frames_;
+    std::thread pacer_;
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::atomic<uint64_t> waited_{0};
+    std::atomic<uint64_t> begun_{0};
+    // Only touched by the render thread.
+    uint64_t ended_ = 0;
+    // Guarded by mutex_.
+    bool stopping_ = false;
+    // Written with mutex_ held, but readable without it. Set until start(), so that acquireFrame() does not block.
+    std::atomic<bool> stopped_{true};
+    // Written by the pacing thread before it sets stopped_.
+    Result waitResult_ = Result::Success;
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
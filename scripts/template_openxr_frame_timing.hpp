@@ -0,0 +1,458 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a recorder of frame pacing telemetry with rolling histograms, readable from any thread.
+ *
+ * @see xr::FrameTimingRecorder
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+#include "openxr_structs.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+//# include('define_assert.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Timing of one frame, as recorded by FrameTimingRecorder.
+ *
+ * @ingroup utilities
+ */
+struct FrameTimingSample {
+    //! Predicted display time returned by `xrWaitFrame`.
+    Time predictedDisplayTime;
+    //! Predicted display period returned by `xrWaitFrame`.
+    Duration predictedDisplayPeriod{0};
+    //! Change in predicted display time since the previous frame, or 0 for the first frame recorded.
+    Duration displayTimeDelta{0};
+    //! Time spent in `xrWaitFrame`.
+    Duration waitTime{0};
+    //! Time from `xrBeginFrame` returning to `xrEndFrame` being called.
+    Duration cpuTime{0};
+    //! The `shouldRender` value returned by `xrWaitFrame`.
+    bool shouldRender = true;
+};
+
+/*!
+ * @brief A histogram of durations with logarithmic buckets, precise to within 1/8 of each value.
+ *
+ * Buckets are 1 µs wide up to 8 µs. Above that, each power of two is split into 8 buckets, up to 8 s; longer durations
+ * land in the last bucket.
+ *
+ * @ingroup utilities
+ */
+struct FrameTimingHistogram {
+    //! Number of buckets.
+    static const uint32_t bucketCount = 168;
+
+    //! Index of the bucket that @p value falls in. Negative values fall in the first bucket.
+    static uint32_t bucketOf(Duration value) noexcept {
+        const int64_t micros = value.get() / 1000;
+        if (micros < 8) {
+            return micros < 0 ? 0 : static_cast<uint32_t>(micros);
+        }
+        // Index of the highest set bit.
+#if defined(__GNUC__) || defined(__clang__)
+        const uint32_t exponent = 63 - static_cast<uint32_t>(__builtin_clzll(static_cast<unsigned long long>(micros)));
+#else
+        uint32_t exponent = 0;
+        uint64_t rest = static_cast<uint64_t>(micros);
+        for (uint32_t shift = 32; shift != 0; shift /= 2) {
+            if ((rest >> shift) != 0) {
+                rest >>= shift;
+                exponent += shift;
+            }
+        }
+#endif
+        const uint32_t bucket = 8 * (exponent - 2) + static_cast<uint32_t>((micros >> (exponent - 3)) & 7);
+        return bucket < bucketCount ? bucket : bucketCount - 1;
+    }
+
+    //! Smallest duration in bucket @p bucket. bucketLowerBound(bucketCount) is the end of the last regular bucket.
+    static Duration bucketLowerBound(uint32_t bucket) noexcept {
+        if (bucket < 8) {
+            return Duration{int64_t(bucket) * 1000};
+        }
+        const uint32_t exponent = bucket / 8 + 2;
+        return Duration{(int64_t(8 + bucket % 8) << (exponent - 3)) * 1000};
+    }
+
+    /*!
+     * @brief Estimate the duration below which @p fraction of the values fall, such as 0.99 for the 99th percentile.
+     *
+     * Returns the upper end of the bucket holding that value, so the estimate errs high by at most one bucket width.
+     * Returns 0 if the histogram is empty.
+     */
+    Duration percentile(double fraction) const noexcept {
+        if (count == 0) {
+            return Duration{0};
+        }
+        const double target = fraction * double(count);
+        uint64_t seen = 0;
+        for (uint32_t bucket = 0; bucket < bucketCount; ++bucket) {
+            seen += buckets[bucket];
+            if (seen != 0 && double(seen) >= target) {
+                return bucketLowerBound(bucket + 1);
+            }
+        }
+        return bucketLowerBound(bucketCount);
+    }
+
+    //! Mean of the values, or 0 if the histogram is empty.
+    Duration mean() const noexcept { return Duration{count == 0 ? 0 : total / int64_t(count)}; }
+
+    //! Number of values in each bucket.
+    uint32_t buckets[bucketCount] = {};
+    //! Number of values.
+    uint32_t count = 0;
+    //! Sum of the values, in nanoseconds.
+    int64_t total = 0;
+};
+
+/*!
+ * @brief Frame pacing statistics over the frames in a FrameTimingRecorder's window.
+ *
+ * @ingroup utilities
+ */
+struct FrameTimingSnapshot {
+    //! Number of frames recorded since construction, including those no longer in the window.
+    uint64_t frameCount = 0;
+    //! Number of frames in the window.
+    uint32_t windowFrameCount = 0;
+    //! Frames in the window for which `xrWaitFrame` returned `shouldRender` false.
+    uint32_t shouldRenderMissCount = 0;
+    //! Frames in the window displayed more than half a display period later than one period after the previous one.
+    uint32_t lateFrameCount = 0;
+    //! Time spent in `xrWaitFrame`.
+    FrameTimingHistogram waitTime;
+    //! Time from `xrBeginFrame` returning to `xrEndFrame` being called.
+    FrameTimingHistogram cpuTime;
+    //! Distance between each frame's display time delta and its predicted display period. Excludes the first frame.
+    FrameTimingHistogram jitter;
+};
+
+/*!
+ * @brief Records frame pacing telemetry around `xrWaitFrame`, `xrBeginFrame` and `xrEndFrame`.
+ *
+ * Call waitFrame(), beginFrame() and endFrame() in place of the Session methods: each forwards to the runtime and
+ * times the call. endFrame() then adds the frame's FrameTimingSample to a ring of the last @p Capacity frames and
+ * updates rolling histograms of wait time, CPU time and display time jitter. Each frame adds its sample to the
+ * histograms and removes the sample it evicts, so recording costs the same regardless of window size, and never
+ * allocates or locks.
+ *
+ * snapshot() and copySamples() may be called from any thread while frames are recorded. They read the recorder
+ * optimistically, retrying if a frame was recorded in the middle of the copy, so they never stall the frame loop.
+ *
+ * waitFrame() may run on a different thread from beginFrame() and endFrame(), as with FramePipeline. Each frame's
+ * beginFrame() picks up the most recent waitFrame() result. Frames whose `xrEndFrame` fails, and frames begun without
+ * a new waitFrame() result, are not recorded. Use addSample() to record frames timed elsewhere.
+ *
+ * @tparam Capacity Number of frames in the window.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t Capacity = 256>
+class FrameTimingRecorder {
+    static_assert(Capacity > 0, "The window must hold at least one frame");
+
+   public:
+    FrameTimingRecorder() = default;
+    FrameTimingRecorder(FrameTimingRecorder const&) = delete;
+    FrameTimingRecorder& operator=(FrameTimingRecorder const&) = delete;
+
+    //! Call `xrWaitFrame`, timing it, and keep the result for the next beginFrame().
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result waitFrame(Session session, FrameWaitInfo const& frameWaitInfo, FrameState& frameState,
+                     Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) noexcept {
+        const Clock::time_point start = Clock::now();
+        const Result result = static_cast<Result>(d.xrWaitFrame(session.get(), frameWaitInfo.get(), frameState.put()));
+        const int64_t waitNs = nanosecondsSince(start);
+        if (succeeded(result)) {
+            const uint64_t sequence = waitSequence_.load(std::memory_order_relaxed);
+            waitSequence_.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            waitedDisplayTime_.store(frameState.predictedDisplayTime.get(), std::memory_order_relaxed);
+            waitedDisplayPeriod_.store(frameState.predictedDisplayPeriod.get(), std::memory_order_relaxed);
+            waitedWaitTime_.store(waitNs, std::memory_order_relaxed);
+            waitedShouldRender_.store(bool(frameState.shouldRender), std::memory_order_relaxed);
+            waitSequence_.store(sequence + 2, std::memory_order_release);
+        }
+        return result;
+    }
+
+    //! Call `xrBeginFrame` for the frame most recently returned by waitFrame(), and start timing its CPU work.
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result beginFrame(Session session, FrameBeginInfo const& frameBeginInfo = FrameBeginInfo{},
+                      Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) noexcept {
+        const uint64_t sequence = loadWaited(frame_);
+        // A frame without a waitFrame() result of its own would count the last one twice.
+        frameWaited_ = sequence != beganSequence_;
+        beganSequence_ = sequence;
+        const Result result = static_cast<Result>(d.xrBeginFrame(session.get(), frameBeginInfo.get()));
+        frameBegin_ = Clock::now();
+        return result;
+    }
+
+    /*!
+     * @brief Call `xrEndFrame`, then record the frame begun by beginFrame().
+     *
+     * The frame is only recorded if `xrEndFrame` succeeded and a waitFrame() result arrived since the previous
+     * beginFrame().
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result endFrame(Session session, FrameEndInfo const& frameEndInfo, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) noexcept {
+        frame_.cpuTime = Duration{nanosecondsSince(frameBegin_)};
+        const Result result = static_cast<Result>(d.xrEndFrame(session.get(), frameEndInfo.get()));
+        if (frameWaited_ && succeeded(result)) {
+            addSample(frame_);
+        }
+        frameWaited_ = false;
+        return result;
+    }
+
+    /*!
+     * @brief Record a frame, evicting the oldest one once the window is full.
+     *
+     * Fills in FrameTimingSample::displayTimeDelta from the previous frame's display time. Calls must not overlap.
+     */
+    void addSample(FrameTimingSample sample) noexcept {
+        sample.displayTimeDelta = Duration{lastDisplayTime_ == 0 ? 0 : sample.predictedDisplayTime.get() - lastDisplayTime_};
+        lastDisplayTime_ = sample.predictedDisplayTime.get();
+
+        const uint64_t frames = frameCount_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[frames % Capacity];
+        const uint64_t version = version_.load(std::memory_order_relaxed);
+        version_.store(version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        if (frames >= Capacity) {
+            FrameTimingSample evicted;
+            slot.load(evicted);
+            account(evicted, -1);
+        }
+        slot.store(sample);
+        account(sample, 1);
+        frameCount_.store(frames + 1, std::memory_order_relaxed);
+        version_.store(version + 2, std::memory_order_release);
+    }
+
+    //! Copy the statistics over the current window into @p snapshot.
+    void snapshot(FrameTimingSnapshot& snapshot) const noexcept {
+        uint64_t version;
+        do {
+            version = beginRead();
+            snapshot.frameCount = frameCount_.load(std::memory_order_relaxed);
+            snapshot.windowFrameCount = static_cast<uint32_t>(snapshot.frameCount < Capacity ? snapshot.frameCount : Capacity);
+            snapshot.shouldRenderMissCount = shouldRenderMisses_.load(std::memory_order_relaxed);
+            snapshot.lateFrameCount = lateFrames_.load(std::memory_order_relaxed);
+            waitTime_.load(snapshot.waitTime);
+            cpuTime_.load(snapshot.cpuTime);
+            jitter_.load(snapshot.jitter);
+        } while (!endRead(version));
+    }
+
+    /*!
+     * @brief Copy up to @p maxCount of the most recent frames into @p samples, oldest first.
+     *
+     * Returns the number of samples copied.
+     */
+    uint32_t copySamples(FrameTimingSample* samples, uint32_t maxCount) const noexcept {
+        uint32_t count;
+        do {
+            const uint64_t version = beginRead();
+            const uint64_t frames = frameCount_.load(std::memory_order_relaxed);
+            count = static_cast<uint32_t>(frames < Capacity ? frames : Capacity);
+            count = count < maxCount ? count : maxCount;
+            for (uint32_t i = 0; i < count; ++i) {
+                slots_[(frames - count + i) % Capacity].load(samples[i]);
+            }
+            if (endRead(version)) {
+                return count;
+            }
+        } while (true);
+    }
+
+    //! Number of frames recorded since construction.
+    uint64_t frameCount() const noexcept { return frameCount_.load(std::memory_order_acquire); }
+
+    //! Number of frames in the window.
+    static OPENXR_HPP_CONSTEXPR uint32_t capacity() noexcept { return Capacity; }
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    static int64_t nanosecondsSince(Clock::time_point start) noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    }
+
+    // A FrameTimingSample, readable while it is being overwritten.
+    struct Slot {
+        std::atomic<XrTime> displayTime{0};
+        std::atomic<int64_t> displayPeriod{0};
+        std::atomic<int64_t> displayTimeDelta{0};
+        std::atomic<int64_t> waitTime{0};
+        std::atomic<int64_t> cpuTime{0};
+        std::atomic<bool> shouldRender{true};
+
+        void store(FrameTimingSample const& sample) noexcept {
+            displayTime.store(sample.predictedDisplayTime.get(), std::memory_order_relaxed);
+            displayPeriod.store(sample.predictedDisplayPeriod.get(), std::memory_order_relaxed);
+            displayTimeDelta.store(sample.displayTimeDelta.get(), std::memory_order_relaxed);
+            waitTime.store(sample.waitTime.get(), std::memory_order_relaxed);
+            cpuTime.store(sample.cpuTime.get(), std::memory_order_relaxed);
+            shouldRender.store(sample.shouldRender, std::memory_order_relaxed);
+        }
+
+        void load(FrameTimingSample& sample) const noexcept {
+            sample.predictedDisplayTime = Time{displayTime.load(std::memory_order_relaxed)};
+            sample.predictedDisplayPeriod = Duration{displayPeriod.load(std::memory_order_relaxed)};
+            sample.displayTimeDelta = Duration{displayTimeDelta.load(std::memory_order_relaxed)};
+            sample.waitTime = Duration{waitTime.load(std::memory_order_relaxed)};
+            sample.cpuTime = Duration{cpuTime.load(std::memory_order_relaxed)};
+            sample.shouldRender = shouldRender.load(std::memory_order_relaxed);
+        }
+    };
+
+    // A FrameTimingHistogram, readable while it is being updated.
+    struct Histogram {
+        std::atomic<uint32_t> buckets[FrameTimingHistogram::bucketCount];
+        std::atomic<uint32_t> count{0};
+        std::atomic<int64_t> total{0};
+
+        Histogram() noexcept {
+            for (std::atomic<uint32_t>& bucket : buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        // Only called by the writer, so plain read-modify-write sequences suffice.
+        void add(Duration value, int sign) noexcept {
+            std::atomic<uint32_t>& bucket = buckets[FrameTimingHistogram::bucketOf(value)];
+            bucket.store(bucket.load(std::memory_order_relaxed) + uint32_t(sign), std::memory_order_relaxed);
+            count.store(count.load(std::memory_order_relaxed) + uint32_t(sign), std::memory_order_relaxed);
+            total.store(total.load(std::memory_order_relaxed) + sign * value.get(), std::memory_order_relaxed);
+        }
+
+        void load(FrameTimingHistogram& histogram) const noexcept {
+            for (uint32_t i = 0; i < FrameTimingHistogram::bucketCount; ++i) {
+                histogram.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+            }
+            histogram.count = count.load(std::memory_order_relaxed);
+            histogram.total = total.load(std::memory_order_relaxed);
+        }
+    };
+
+    static void bump(std::atomic<uint32_t>& counter, int sign) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + uint32_t(sign), std::memory_order_relaxed);
+    }
+
+    // Add (sign 1) or remove (sign -1) a sample from the window's statistics.
+    void account(FrameTimingSample const& sample, int sign) noexcept {
+        waitTime_.add(sample.waitTime, sign);
+        cpuTime_.add(sample.cpuTime, sign);
+        if (!sample.shouldRender) {
+            bump(shouldRenderMisses_, sign);
+        }
+        if (sample.displayTimeDelta.get() != 0) {
+            const int64_t deviation = sample.displayTimeDelta.get() - sample.predictedDisplayPeriod.get();
+            jitter_.add(Duration{deviation < 0 ? -deviation : deviation}, sign);
+            if (2 * deviation > sample.predictedDisplayPeriod.get()) {
+                bump(lateFrames_, sign);
+            }
+        }
+    }
+
+    // Seqlock read: the version is odd while addSample() is changing the window.
+    uint64_t beginRead() const noexcept {
+        uint64_t version;
+        while (((version = version_.load(std::memory_order_acquire)) & 1) != 0) {
+        }
+        return version;
+    }
+
+    bool endRead(uint64_t version) const noexcept {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return version_.load(std::memory_order_relaxed) == version;
+    }
+
+    // The latest waitFrame() result, handed from the waiting thread to beginFrame() through a seqlock. Returns its
+    // sequence number, which is 0 if there has been none.
+    uint64_t loadWaited(FrameTimingSample& sample) const noexcept {
+        uint64_t sequence;
+        do {
+            while (((sequence = waitSequence_.load(std::memory_order_acquire)) & 1) != 0) {
+            }
+            sample.predictedDisplayTime = Time{waitedDisplayTime_.load(std::memory_order_relaxed)};
+            sample.predictedDisplayPeriod = Duration{waitedDisplayPeriod_.load(std::memory_order_relaxed)};
+            sample.waitTime = Duration{waitedWaitTime_.load(std::memory_order_relaxed)};
+            sample.shouldRender = waitedShouldRender_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while (waitSequence_.load(std::memory_order_relaxed) != sequence);
+        return sequence;
+    }
+
+    // Written by waitFrame().
+    std::atomic<uint64_t> waitSequence_{0};
+    std::atomic<XrTime> waitedDisplayTime_{0};
+    std::atomic<int64_t> waitedDisplayPeriod_{0};
+    std::atomic<int64_t> waitedWaitTime_{0};
+    std::atomic<bool> waitedShouldRender_{true};
+
+    // Only touched by beginFrame(), endFrame() and addSample().
+    FrameTimingSample frame_;
+    Clock::time_point frameBegin_;
+    uint64_t beganSequence_ = 0;
+    bool frameWaited_ = false;
+    XrTime lastDisplayTime_ = 0;
+
+    // Written by addSample(), read by snapshot() and copySamples().
+    std::atomic<uint64_t> version_{0};
+    std::atomic<uint64_t> frameCount_{0};
+    std::atomic<uint32_t> shouldRenderMisses_{0};
+    std::atomic<uint32_t> lateFrames_{0};
+    Histogram waitTime_;
+    Histogram cpuTime_;
+    Histogram jitter_;
+    Slot slots_[Capacity];
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
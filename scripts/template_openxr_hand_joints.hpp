@@ -0,0 +1,243 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains structure-of-arrays storage and batched kernels for XR_EXT_hand_tracking joint locations.
+ *
+ * @see xr::HandJointsSoA, xr::locateHandJoints
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+#include "openxr_math.hpp"
+#include "openxr_method_impls.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+//# include('define_namespace.hpp') without context
+
+#if defined(XR_EXT_hand_tracking)
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Joint locations of one hand, stored as one array per component.
+ *
+ * Filled by locateHandJoints(). Bit `i` of each mask corresponds to joint `i`, as numbered by HandJointEXT.
+ * Use poses() and positions() to run the batched functions of openxr_math.hpp on the joints directly.
+ *
+ * @tparam JointCount The number of joints in the joint set: at most 32.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t JointCount = XR_HAND_JOINT_COUNT_EXT>
+struct HandJointsSoA {
+    static_assert(JointCount <= 32, "Joint masks are 32 bits wide");
+
+    float orientationX[JointCount];
+    float orientationY[JointCount];
+    float orientationZ[JointCount];
+    float orientationW[JointCount];
+    float positionX[JointCount];
+    float positionY[JointCount];
+    float positionZ[JointCount];
+    float radius[JointCount];
+    //! Joints whose orientation and position are both valid.
+    uint32_t validMask;
+    //! Joints whose orientation and position are both actively tracked.
+    uint32_t trackedMask;
+    //! Whether the runtime reported the hand as active.
+    bool isActive;
+
+    //! The number of joints stored.
+    static OPENXR_HPP_CONSTEXPR uint32_t size() noexcept { return JointCount; }
+
+    //! Mutable view of the joint poses.
+    math::PosefSoA poses() noexcept {
+        return {{orientationX, orientationY, orientationZ, orientationW}, {positionX, positionY, positionZ}};
+    }
+
+    //! Mutable view of the joint positions.
+    math::Vector3fSoA positions() noexcept { return {positionX, positionY, positionZ}; }
+
+    //! Gather the pose of a single joint.
+    Posef pose(HandJointEXT joint) const noexcept {
+        uint32_t i = static_cast<uint32_t>(joint);
+        return {{orientationX[i], orientationY[i], orientationZ[i], orientationW[i]}, {positionX[i], positionY[i], positionZ[i]}};
+    }
+
+    //! Gather the position of a single joint.
+    Vector3f position(HandJointEXT joint) const noexcept {
+        uint32_t i = static_cast<uint32_t>(joint);
+        return {positionX[i], positionY[i], positionZ[i]};
+    }
+
+    //! Whether the pose of @p joint is valid.
+    bool isValid(HandJointEXT joint) const noexcept { return (validMask >> static_cast<uint32_t>(joint)) & 1u; }
+};
+
+namespace impl {
+template <uint32_t JointCount>
+OPENXR_HPP_INLINE void scatterHandJoints(HandJointLocationEXT const* joints, bool isActive, HandJointsSoA<JointCount>& out) noexcept {
+    const SpaceLocationFlags validBits = SpaceLocationFlagBits::OrientationValid | SpaceLocationFlagBits::PositionValid;
+    const SpaceLocationFlags trackedBits = SpaceLocationFlagBits::OrientationTracked | SpaceLocationFlagBits::PositionTracked;
+    uint32_t validMask = 0;
+    uint32_t trackedMask = 0;
+    for (uint32_t i = 0; i < JointCount; ++i) {
+        HandJointLocationEXT const& joint = joints[i];
+        out.orientationX[i] = joint.pose.orientation.x;
+        out.orientationY[i] = joint.pose.orientation.y;
+        out.orientationZ[i] = joint.pose.orientation.z;
+        out.orientationW[i] = joint.pose.orientation.w;
+        out.positionX[i] = joint.pose.position.x;
+        out.positionY[i] = joint.pose.position.y;
+        out.positionZ[i] = joint.pose.position.z;
+        out.radius[i] = joint.radius;
+        validMask |= uint32_t(joint.locationFlags.all(validBits)) << i;
+        trackedMask |= uint32_t(joint.locationFlags.all(trackedBits)) << i;
+    }
+    out.validMask = isActive ? validMask : 0;
+    out.trackedMask = isActive ? trackedMask : 0;
+    out.isActive = isActive;
+}
+
+// The batched math functions take mutable views, but only read from their inputs.
+template <uint32_t JointCount>
+OPENXR_HPP_INLINE math::Vector3fSoA readOnlyPositions(HandJointsSoA<JointCount> const& hand) noexcept {
+    return const_cast<HandJointsSoA<JointCount>&>(hand).positions();
+}
+}  // namespace impl
+
+/*!
+ * @brief Locate the joints of one hand into structure-of-arrays storage.
+ *
+ * Wraps HandTrackerEXT::locateHandJointsEXT, locating into a stack buffer and transposing the result.
+ * On failure, @p out is marked inactive with empty masks.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t JointCount, typename Dispatch OPENXR_HPP_DEFAULT_EXT_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+OPENXR_HPP_INLINE Result locateHandJoints(HandTrackerEXT tracker, Space baseSpace, Time time, HandJointsSoA<JointCount>& out,
+                                          Dispatch&& d OPENXR_HPP_DEFAULT_EXT_DISPATCH_ARG) {
+    HandJointLocationEXT joints[JointCount];
+    HandJointLocationsEXT locations;
+    locations.jointCount = JointCount;
+    locations.jointLocations = joints;
+    Result result = tracker.locateHandJointsEXT(HandJointsLocateInfoEXT{baseSpace, time}, locations, std::forward<Dispatch>(d));
+    if (failed(result)) {
+        out.validMask = 0;
+        out.trackedMask = 0;
+        out.isActive = false;
+        return result;
+    }
+    impl::scatterHandJoints(joints, static_cast<bool>(locations.isActive), out);
+    return result;
+}
+
+/*!
+ * @brief Locate the joints of both hands into structure-of-arrays storage.
+ *
+ * @returns the first failing result, or the result of locating the right hand if both succeed.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t JointCount, typename Dispatch OPENXR_HPP_DEFAULT_EXT_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+OPENXR_HPP_INLINE Result locateHandJoints(HandTrackerEXT leftTracker, HandTrackerEXT rightTracker, Space baseSpace, Time time,
+                                          HandJointsSoA<JointCount>& left, HandJointsSoA<JointCount>& right,
+                                          Dispatch&& d OPENXR_HPP_DEFAULT_EXT_DISPATCH_ARG) {
+    Result leftResult = locateHandJoints(leftTracker, baseSpace, time, left, d);
+    Result rightResult = locateHandJoints(rightTracker, baseSpace, time, right, d);
+    return failed(leftResult) ? leftResult : rightResult;
+}
+
+/*!
+ * @brief Re-express all joint poses in another space: each pose becomes `compose(newBaseFromBase, pose)`.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t JointCount>
+OPENXR_HPP_INLINE void transformHandJoints(Posef const& newBaseFromBase, HandJointsSoA<JointCount>& hand) noexcept {
+    math::composePoses(newBaseFromBase, hand.poses(), hand.poses(), JointCount);
+}
+
+/*!
+ * @brief Squared distance from @p joint to every joint of the same hand.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t JointCount>
+OPENXR_HPP_INLINE void squaredJointDistances(HandJointsSoA<JointCount> const& hand, HandJointEXT joint, float (&out)[JointCount]) noexcept {
+    math::squaredDistances(hand.position(joint), impl::readOnlyPositions(hand), out, JointCount);
+}
+
+/*!
+ * @brief Squared distance between each joint of @p a and the same joint of @p b, for example the left and right hands.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t JointCount>
+OPENXR_HPP_INLINE void squaredJointDistances(HandJointsSoA<JointCount> const& a, HandJointsSoA<JointCount> const& b,
+                                             float (&out)[JointCount]) noexcept {
+    math::squaredDistances(impl::readOnlyPositions(a), impl::readOnlyPositions(b), out, JointCount);
+}
+
+/*!
+ * @brief Mask of the valid joints within @p distance of @p joint, such as the fingertips touching the thumb tip.
+ *
+ * Empty if @p joint itself is not valid.
+ *
+ * @ingroup utilities
+ */
+template <uint32_t JointCount>
+OPENXR_HPP_INLINE uint32_t jointsWithin(HandJointsSoA<JointCount> const& hand, HandJointEXT joint, float distance) noexcept {
+    if (!hand.isValid(joint)) {
+        return 0;
+    }
+    float squared[JointCount];
+    squaredJointDistances(hand, joint, squared);
+    const float limit = distance * distance;
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < JointCount; ++i) {
+        mask |= uint32_t(squared[i] <= limit) << i;
+    }
+    return mask & hand.validMask;
+}
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+#endif  // defined(XR_EXT_hand_tracking)
+
+//# include('file_footer.hpp')
@@ -62,6 +62,20 @@
 #include <vector>
 #endif  // !OPENXR_HPP_DISABLE_ENHANCED_MODE
 
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// MSVC's /std:c++latest reports a _MSVC_LANG past C++20 rather than 202302L.
+#if defined(__has_include) && (__cplusplus >= 202302L || (defined(_MSVC_LANG) && _MSVC_LANG > 202002L))
+#if __has_include(<expected>)
+#include <expected>
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#define OPENXR_HPP_HAS_STD_EXPECTED
+#endif
+#endif
+#endif
+
 //# include('define_inline_constexpr.hpp') without context
 //# include('define_conversion.hpp') without context
 //# include('define_namespace.hpp') without context
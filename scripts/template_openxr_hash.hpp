@@ -0,0 +1,344 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains field-wise equality of projected structs, and `std::hash` specializations for them and for handles,
+ * atoms and wrappers.
+ *
+ * The hashes are consistent with equality, so that structs such as create-infos can be keys of unordered containers.
+ * Kept apart from openxr_structs.hpp, since comparing and hashing hundreds of structs adds to the time to compile it.
+ *
+ * @ingroup utilities
+ */
+
+#include "openxr_structs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+//# include('define_inline_constexpr.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+//! Implementation details
+namespace impl {
+
+//! Compares members with their own operator==, such as those of other structs, atoms and handles.
+template <typename T>
+OPENXR_HPP_INLINE auto membersEqual(T const& lhs, T const& rhs, int) noexcept -> decltype(bool(lhs == rhs)) {
+    return lhs == rhs;
+}
+
+//! Compares members of platform types that have no operator==, such as `LUID`, byte-wise.
+template <typename T>
+OPENXR_HPP_INLINE bool membersEqual(T const& lhs, T const& rhs, long) noexcept {
+    return memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+//! Compares fixed-size array members element-wise, rather than by address.
+template <typename T, size_t N>
+OPENXR_HPP_INLINE bool membersEqual(T const (&lhs)[N], T const (&rhs)[N], int) noexcept {
+    for (size_t i = 0; i < N; ++i) {
+        if (!membersEqual(lhs[i], rhs[i], 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Compares fixed-size string members by content, up to the terminator.
+template <size_t N>
+OPENXR_HPP_INLINE bool fixedStringsEqual(const char (&lhs)[N], const char (&rhs)[N]) noexcept {
+    return strncmp(lhs, rhs, N) == 0;
+}
+
+//! Compares null-terminated string members by content.
+OPENXR_HPP_INLINE bool stringsEqual(const char* lhs, const char* rhs) noexcept {
+    return lhs == rhs || (lhs != nullptr && rhs != nullptr && strcmp(lhs, rhs) == 0);
+}
+
+}  // namespace impl
+
+//! @addtogroup utility_accessors
+//! @{
+
+//# for struct in gen.api_structures if struct.name not in manually_projected
+//#     set s = project_struct(struct)
+//#     set members = struct.members | reject('cpp_hidden_member') | list
+//#     if s.is_abstract
+//#         set members = [struct.members[0]] + members
+//#     endif
+/*{ protect_begin(struct) }*/
+//#     filter block_doxygen_comment
+//! @brief Field-wise equality of two /*{s.cpp_name}*/ values/*% if s.is_abstract %*/, including `type` but not `next`/*% elif s.typed_struct %*/, ignoring `type` and `next`/*% endif %*/.
+//!
+//! Fixed-size strings and null-terminated strings are compared by content, and other pointers by address.
+//! @relates /*{s.cpp_name}*/
+//#     endfilter
+inline bool operator==(/*{s.cpp_name}*/ const& lhs, /*{s.cpp_name}*/ const& rhs) noexcept {
+//#     if members
+//#         set and_ = joiner("&& ")
+    return
+//#         for member in members
+//#             if is_static_length_string(member)
+        /*{ and_() }*/impl::fixedStringsEqual(lhs./*{member.name}*/, rhs./*{member.name}*/)
+//#             elif member.type == "char" and member.pointer_count == 1
+        /*{ and_() }*/impl::stringsEqual(lhs./*{member.name}*/, rhs./*{member.name}*/)
+//#             else
+        /*{ and_() }*/impl::membersEqual(lhs./*{member.name}*/, rhs./*{member.name}*/, 0)
+//#             endif
+//#         endfor
+        ;
+//#     else
+    return (void)lhs, (void)rhs, true;
+//#     endif
+}
+
+//! @brief Field-wise inequality of two /*{s.cpp_name}*/ values, as by operator==.
+//! @relates /*{s.cpp_name}*/
+inline bool operator!=(/*{s.cpp_name}*/ const& lhs, /*{s.cpp_name}*/ const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+/*{ protect_end(struct) }*/
+//# endfor
+
+//! @}
+
+namespace impl {
+
+//! Accumulates the members of a value into a 64-bit hash, a word at a time, with the multiply-xorshift step of the
+//! name hashing in openxr_enums.hpp.
+class StructHasher {
+   public:
+    void add(uint64_t word) noexcept { m_hash = mixNameWord(m_hash, word); }
+
+    //! Adds @p size bytes eight at a time, then the length, so that strings that are prefixes of one another differ.
+    void addBytes(const void* data, size_t size) noexcept {
+        const char* bytes = static_cast<const char*>(data);
+        for (; size >= 8; bytes += 8, size -= 8) {
+            add(loadWord(bytes));
+        }
+        add(loadPartialWord(bytes, size) ^ (uint64_t(size) << 56));
+    }
+
+    size_t hash() const noexcept { return static_cast<size_t>(m_hash); }
+
+   private:
+    uint64_t m_hash = 0;
+};
+
+/*!
+ * @defgroup hashing Hashing
+ * @brief Overloads of `hashValue()` for each hashed type, found by argument-dependent lookup on StructHasher.
+ * @{
+ */
+
+template <typename T>
+OPENXR_HPP_INLINE typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type hashValue(
+    StructHasher& hasher, T value) noexcept {
+    hasher.add(static_cast<uint64_t>(value));
+}
+
+//! Zeros of either sign compare equal, so they hash the same.
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, float value) noexcept {
+    uint32_t bits = 0;
+    if (value != 0.0f) {
+        memcpy(&bits, &value, sizeof(bits));
+    }
+    hasher.add(bits);
+}
+
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, double value) noexcept {
+    uint64_t bits = 0;
+    if (value != 0.0) {
+        memcpy(&bits, &value, sizeof(bits));
+    }
+    hasher.add(bits);
+}
+
+//! Taken by reference, so that arrays are not converted to pointers and are hashed by element instead.
+template <typename T>
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, T* const& pointer) noexcept {
+    hasher.add(reinterpret_cast<uintptr_t>(pointer));
+}
+
+template <typename T>
+OPENXR_HPP_INLINE auto hashMember(StructHasher& hasher, T const& value, int) noexcept -> decltype(hashValue(hasher, value)) {
+    hashValue(hasher, value);
+}
+
+//! Members of platform types, such as `LUID`, byte-wise, as they are compared.
+template <typename T>
+OPENXR_HPP_INLINE void hashMember(StructHasher& hasher, T const& value, long) noexcept {
+    hasher.addBytes(&value, sizeof(T));
+}
+
+template <typename T, size_t N>
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, T const (&values)[N]) noexcept {
+    for (size_t i = 0; i < N; ++i) {
+        hashMember(hasher, values[i], 0);
+    }
+}
+
+template <size_t N>
+OPENXR_HPP_INLINE void hashFixedString(StructHasher& hasher, const char (&text)[N]) noexcept {
+    hasher.addBytes(text, strnlen(text, N));
+}
+
+OPENXR_HPP_INLINE void hashString(StructHasher& hasher, const char* text) noexcept {
+    if (text == nullptr) {
+        hasher.add(0);
+    } else {
+        hasher.addBytes(text, strlen(text));
+    }
+}
+
+template <typename BitType, typename MaskType>
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, Flags<BitType, MaskType> const& flags) noexcept {
+    hasher.add(static_cast<uint64_t>(flags.get()));
+}
+
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, Bool32 const& value) noexcept { hasher.add(value.get()); }
+
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, Time const& value) noexcept {
+    hasher.add(static_cast<uint64_t>(value.get()));
+}
+
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, Duration const& value) noexcept {
+    hasher.add(static_cast<uint64_t>(value.get()));
+}
+
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, Version const& value) noexcept { hasher.add(value.get()); }
+
+//# for raw_type in gen.dict_atoms.keys()
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, /*{ project_type_name(raw_type) }*/ const& value) noexcept { hasher.add(value.get()); }
+//# endfor
+
+//## Raw handles are pointers on 64-bit platforms and integers elsewhere.
+OPENXR_HPP_INLINE void hashRawHandle(StructHasher& hasher, uint64_t handle) noexcept { hasher.add(handle); }
+
+template <typename T>
+OPENXR_HPP_INLINE void hashRawHandle(StructHasher& hasher, T* handle) noexcept {
+    hasher.add(reinterpret_cast<uintptr_t>(handle));
+}
+
+//# for handle in gen.api_handles
+/*{ protect_begin(handle) }*/
+OPENXR_HPP_INLINE void hashValue(StructHasher& hasher, /*{ project_type_name(handle.name) }*/ const& value) noexcept {
+    hashRawHandle(hasher, value.get());
+}
+/*{ protect_end(handle) }*/
+//# endfor
+
+//## Declared first, since structs contain other structs.
+//# for struct in gen.api_structures if struct.name not in manually_projected
+/*{ protect_begin(struct) }*/
+inline void hashValue(StructHasher& hasher, /*{ project_type_name(struct.name) }*/ const& value) noexcept;
+/*{ protect_end(struct) }*/
+//# endfor
+
+//## Hashes the members that operator== compares, in the same way.
+//# for struct in gen.api_structures if struct.name not in manually_projected
+//#     set s = project_struct(struct)
+//#     set members = struct.members | reject('cpp_hidden_member') | list
+//#     if s.is_abstract
+//#         set members = [struct.members[0]] + members
+//#     endif
+/*{ protect_begin(struct) }*/
+inline void hashValue(StructHasher& hasher, /*{ s.cpp_name }*/ const& value) noexcept {
+//#     for member in members
+//#         if is_static_length_string(member)
+    hashFixedString(hasher, value./*{ member.name }*/);
+//#         elif member.type == "char" and member.pointer_count == 1
+    hashString(hasher, value./*{ member.name }*/);
+//#         else
+    hashMember(hasher, value./*{ member.name }*/, 0);
+//#         endif
+//#     else
+    (void)hasher;
+    (void)value;
+//#     endfor
+}
+/*{ protect_end(struct) }*/
+//# endfor
+
+//! @}
+
+//! Base of the `std::hash` specializations.
+template <typename T>
+struct ValueHash {
+    size_t operator()(T const& value) const noexcept {
+        StructHasher hasher;
+        hashValue(hasher, value);
+        return hasher.hash();
+    }
+};
+
+}  // namespace impl
+}  // namespace OPENXR_HPP_NAMESPACE
+
+namespace std {
+//! @brief Hash of a Flags value, as its mask.
+template <typename BitType, typename MaskType>
+struct hash<OPENXR_HPP_NAMESPACE::Flags<BitType, MaskType>>
+    : OPENXR_HPP_NAMESPACE::impl::ValueHash<OPENXR_HPP_NAMESPACE::Flags<BitType, MaskType>> {};
+
+//# for type in ["Bool32", "Time", "Duration", "Version"] + (gen.dict_atoms.keys() | map("replace", "Xr", "") | list)
+template <>
+struct hash<OPENXR_HPP_NAMESPACE::/*{ type }*/> : OPENXR_HPP_NAMESPACE::impl::ValueHash<OPENXR_HPP_NAMESPACE::/*{ type }*/> {};
+//# endfor
+
+//# for handle in gen.api_handles
+/*{ protect_begin(handle) }*/
+template <>
+struct hash<OPENXR_HPP_NAMESPACE::/*{ project_type_name(handle.name) }*/>
+    : OPENXR_HPP_NAMESPACE::impl::ValueHash<OPENXR_HPP_NAMESPACE::/*{ project_type_name(handle.name) }*/> {};
+/*{ protect_end(handle) }*/
+//# endfor
+
+//# for struct in gen.api_structures if struct.name not in manually_projected
+/*{ protect_begin(struct) }*/
+//! @brief Hash of a /*{ project_type_name(struct.name) }*/, consistent with its field-wise operator==.
+template <>
+struct hash<OPENXR_HPP_NAMESPACE::/*{ project_type_name(struct.name) }*/>
+    : OPENXR_HPP_NAMESPACE::impl::ValueHash<OPENXR_HPP_NAMESPACE::/*{ project_type_name(struct.name) }*/> {};
+/*{ protect_end(struct) }*/
+//# endfor
+}  // namespace std
+
+//# include('file_footer.hpp')
@@ -0,0 +1,569 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains pose, quaternion and vector math on the projected math types, including batched kernels over structure-of-arrays data.
+ *
+ * The batched kernels use SSE on x86 and NEON on ARM. Define `OPENXR_HPP_NO_SIMD` to force the portable scalar code.
+ *
+ * @see xr::math
+ * @ingroup utilities
+ */
+
+#include "openxr_structs.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+#if !defined(OPENXR_HPP_NO_SIMD)
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define OPENXR_HPP_MATH_SSE
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define OPENXR_HPP_MATH_NEON
+#endif
+#endif  // !defined(OPENXR_HPP_NO_SIMD)
+
+//# include('define_namespace.hpp') without context
+
+/**
+ * @def OPENXR_HPP_NO_SIMD
+ * @brief Define to disable the SSE/NEON code paths in openxr_math.hpp and use only portable scalar code.
+ *
+ * @ingroup config
+ */
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Pose, quaternion and vector math on the projected types.
+ *
+ * Poses follow the OpenXR convention: `compose(aFromB, bFromC)` yields `aFromC`,
+ * and `transform(aFromB, pointInB)` yields the point in space A.
+ * Quaternions are assumed to be normalized unless stated otherwise.
+ *
+ * @ingroup utilities
+ */
+namespace math {
+
+/*!
+ * @brief A 4x4 matrix of floats stored in column-major order, as expected by OpenGL and Vulkan.
+ *
+ * @ingroup utilities
+ */
+struct Matrix4x4f {
+    float m[16];
+};
+
+/*!
+ * @name Vector operations
+ * @{
+ */
+//! Component-wise sum.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Vector3f add(Vector3f const& a, Vector3f const& b) noexcept {
+    return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+
+//! Component-wise difference.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Vector3f subtract(Vector3f const& a, Vector3f const& b) noexcept {
+    return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+//! Multiply every component by @p s.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Vector3f scale(Vector3f const& v, float s) noexcept {
+    return {v.x * s, v.y * s, v.z * s};
+}
+
+//! Dot product.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE float dot(Vector3f const& a, Vector3f const& b) noexcept {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+//! Cross product.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Vector3f cross(Vector3f const& a, Vector3f const& b) noexcept {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+//! Euclidean length.
+OPENXR_HPP_INLINE float length(Vector3f const& v) noexcept { return std::sqrt(dot(v, v)); }
+
+//! Scale to unit length. A zero vector is returned unchanged.
+OPENXR_HPP_INLINE Vector3f normalize(Vector3f const& v) noexcept {
+    float len = length(v);
+    return len > 0.f ? scale(v, 1.f / len) : v;
+}
+//! @}
+
+/*!
+ * @name Quaternion operations
+ * @{
+ */
+//! Hamilton product: rotating by the result is rotating by @p b and then by @p a.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Quaternionf multiply(Quaternionf const& a, Quaternionf const& b) noexcept {
+    return {a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y, a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+            a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w, a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
+}
+
+//! Conjugate, which is the inverse of a unit quaternion.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Quaternionf conjugate(Quaternionf const& q) noexcept { return {-q.x, -q.y, -q.z, q.w}; }
+
+//! Four-dimensional dot product.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE float dot(Quaternionf const& a, Quaternionf const& b) noexcept {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+//! Scale to unit length. A zero quaternion becomes the identity.
+OPENXR_HPP_INLINE Quaternionf normalize(Quaternionf const& q) noexcept {
+    float len = std::sqrt(dot(q, q));
+    if (len <= 0.f) {
+        return {};
+    }
+    float inv = 1.f / len;
+    return {q.x * inv, q.y * inv, q.z * inv, q.w * inv};
+}
+
+//! Rotation of @p angle radians around the unit vector @p axis.
+OPENXR_HPP_INLINE Quaternionf fromAxisAngle(Vector3f const& axis, float angle) noexcept {
+    float s = std::sin(angle * 0.5f);
+    return {axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f)};
+}
+
+namespace impl {
+// rotate() with t = 2 * cross(q.xyz, v) already computed, so it can stay a single C++11 constexpr expression.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Vector3f rotateWith(Quaternionf const& q, Vector3f const& v, Vector3f const& t) noexcept {
+    return add(add(v, scale(t, q.w)), cross({q.x, q.y, q.z}, t));
+}
+}  // namespace impl
+
+//! Rotate the vector @p v by the unit quaternion @p q.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Vector3f rotate(Quaternionf const& q, Vector3f const& v) noexcept {
+    return impl::rotateWith(q, v, scale(cross({q.x, q.y, q.z}, v), 2.f));
+}
+
+/*!
+ * @brief Spherical linear interpolation between two unit quaternions along the shortest arc.
+ *
+ * @p t of 0 yields @p a and 1 yields @p b. Nearly parallel inputs fall back to normalized linear interpolation.
+ */
+OPENXR_HPP_INLINE Quaternionf slerp(Quaternionf const& a, Quaternionf const& b, float t) noexcept {
+    float cosTheta = dot(a, b);
+    float sign = 1.f;
+    if (cosTheta < 0.f) {
+        cosTheta = -cosTheta;
+        sign = -1.f;
+    }
+    float wa = 1.f - t;
+    float wb = t;
+    if (cosTheta < 0.9995f) {
+        float theta = std::acos(cosTheta);
+        float invSin = 1.f / std::sin(theta);
+        wa = std::sin(wa * theta) * invSin;
+        wb = std::sin(wb * theta) * invSin;
+    }
+    wb *= sign;
+    Quaternionf result{wa * a.x + wb * b.x, wa * a.y + wb * b.y, wa * a.z + wb * b.z, wa * a.w + wb * b.w};
+    return cosTheta < 0.9995f ? result : normalize(result);
+}
+//! @}
+
+/*!
+ * @name Pose operations
+ * @{
+ */
+//! Compose @p aFromB with @p bFromC, yielding aFromC.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Posef compose(Posef const& aFromB, Posef const& bFromC) noexcept {
+    return {multiply(aFromB.orientation, bFromC.orientation), add(aFromB.position, rotate(aFromB.orientation, bFromC.position))};
+}
+
+//! Invert @p aFromB, yielding bFromA.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Posef inverse(Posef const& aFromB) noexcept {
+    return {conjugate(aFromB.orientation), scale(rotate(conjugate(aFromB.orientation), aFromB.position), -1.f)};
+}
+
+//! Transform @p pointInB into space A.
+OPENXR_HPP_CONSTEXPR OPENXR_HPP_INLINE Vector3f transform(Posef const& aFromB, Vector3f const& pointInB) noexcept {
+    return add(aFromB.position, rotate(aFromB.orientation, pointInB));
+}
+
+//! Column-major rigid transform matrix equivalent to @p pose.
+OPENXR_HPP_INLINE Matrix4x4f toMatrix(Posef const& pose) noexcept {
+    Quaternionf const& q = pose.orientation;
+    float x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+    float xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+    float xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+    float wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+    return {{1.f - (yy + zz), xy + wz, xz - wy, 0.f,  //
+             xy - wz, 1.f - (xx + zz), yz + wx, 0.f,  //
+             xz + wy, yz - wx, 1.f - (xx + yy), 0.f,  //
+             pose.position.x, pose.position.y, pose.position.z, 1.f}};
+}
+//! @}
+
+/*!
+ * @brief Mutable structure-of-arrays view of 3D vectors: element `i` is `{x[i], y[i], z[i]}`.
+ *
+ * @ingroup utilities
+ */
+struct Vector3fSoA {
+    float* x;
+    float* y;
+    float* z;
+};
+
+/*!
+ * @brief Mutable structure-of-arrays view of quaternions.
+ *
+ * @ingroup utilities
+ */
+struct QuaternionfSoA {
+    float* x;
+    float* y;
+    float* z;
+    float* w;
+};
+
+/*!
+ * @brief Mutable structure-of-arrays view of poses.
+ *
+ * @ingroup utilities
+ */
+struct PosefSoA {
+    QuaternionfSoA orientation;
+    Vector3fSoA position;
+};
+
+namespace impl {
+namespace simd {
+// Four float lanes. The native vector type is wrapped so it can be used as a template argument
+// without its alignment attributes being dropped.
+struct f32x4 {
+#if defined(OPENXR_HPP_MATH_SSE)
+    __m128 v;
+#elif defined(OPENXR_HPP_MATH_NEON)
+    float32x4_t v;
+#else
+    float v[4];
+#endif
+};
+
+// Lane operations, specialized for a single float (scalar tails) and for four lanes, so that
+// each kernel is written once as a template on the lane type.
+template <typename V>
+struct Ops;
+
+template <>
+struct Ops<float> {
+    static float load(float const* p) noexcept { return *p; }
+    static void store(float* p, float v) noexcept { *p = v; }
+    static float splat(float s) noexcept { return s; }
+    static float add(float a, float b) noexcept { return a + b; }
+    static float sub(float a, float b) noexcept { return a - b; }
+    static float mul(float a, float b) noexcept { return a * b; }
+};
+
+template <>
+struct Ops<f32x4> {
+#if defined(OPENXR_HPP_MATH_SSE)
+    static f32x4 load(float const* p) noexcept { return {_mm_loadu_ps(p)}; }
+    static void store(float* p, f32x4 v) noexcept { _mm_storeu_ps(p, v.v); }
+    static f32x4 splat(float s) noexcept { return {_mm_set1_ps(s)}; }
+    static f32x4 add(f32x4 a, f32x4 b) noexcept { return {_mm_add_ps(a.v, b.v)}; }
+    static f32x4 sub(f32x4 a, f32x4 b) noexcept { return {_mm_sub_ps(a.v, b.v)}; }
+    static f32x4 mul(f32x4 a, f32x4 b) noexcept { return {_mm_mul_ps(a.v, b.v)}; }
+#elif defined(OPENXR_HPP_MATH_NEON)
+    static f32x4 load(float const* p) noexcept { return {vld1q_f32(p)}; }
+    static void store(float* p, f32x4 v) noexcept { vst1q_f32(p, v.v); }
+    static f32x4 splat(float s) noexcept { return {vdupq_n_f32(s)}; }
+    static f32x4 add(f32x4 a, f32x4 b) noexcept { return {vaddq_f32(a.v, b.v)}; }
+    static f32x4 sub(f32x4 a, f32x4 b) noexcept { return {vsubq_f32(a.v, b.v)}; }
+    static f32x4 mul(f32x4 a, f32x4 b) noexcept { return {vmulq_f32(a.v, b.v)}; }
+#else
+    static f32x4 load(float const* p) noexcept { return {{p[0], p[1], p[2], p[3]}}; }
+    static void store(float* p, f32x4 v) noexcept {
+        for (int i = 0; i < 4; ++i) {
+            p[i] = v.v[i];
+        }
+    }
+    static f32x4 splat(float s) noexcept { return {{s, s, s, s}}; }
+    static f32x4 add(f32x4 a, f32x4 b) noexcept { return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}}; }
+    static f32x4 sub(f32x4 a, f32x4 b) noexcept { return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}}; }
+    static f32x4 mul(f32x4 a, f32x4 b) noexcept { return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}}; }
+#endif
+};
+
+template <typename V>
+struct Vec3 {
+    V x, y, z;
+
+    static Vec3 splat(Vector3f const& v) noexcept { return {Ops<V>::splat(v.x), Ops<V>::splat(v.y), Ops<V>::splat(v.z)}; }
+    static Vec3 load(Vector3fSoA const& s, size_t i) noexcept {
+        return {Ops<V>::load(s.x + i), Ops<V>::load(s.y + i), Ops<V>::load(s.z + i)};
+    }
+    void store(Vector3fSoA const& s, size_t i) const noexcept {
+        Ops<V>::store(s.x + i, x);
+        Ops<V>::store(s.y + i, y);
+        Ops<V>::store(s.z + i, z);
+    }
+};
+
+template <typename V>
+struct Quat {
+    V x, y, z, w;
+
+    static Quat splat(Quaternionf const& q) noexcept {
+        return {Ops<V>::splat(q.x), Ops<V>::splat(q.y), Ops<V>::splat(q.z), Ops<V>::splat(q.w)};
+    }
+    static Quat load(QuaternionfSoA const& s, size_t i) noexcept {
+        return {Ops<V>::load(s.x + i), Ops<V>::load(s.y + i), Ops<V>::load(s.z + i), Ops<V>::load(s.w + i)};
+    }
+    void store(QuaternionfSoA const& s, size_t i) const noexcept {
+        Ops<V>::store(s.x + i, x);
+        Ops<V>::store(s.y + i, y);
+        Ops<V>::store(s.z + i, z);
+        Ops<V>::store(s.w + i, w);
+    }
+};
+
+template <typename V>
+OPENXR_HPP_INLINE Vec3<V> add(Vec3<V> const& a, Vec3<V> const& b) noexcept {
+    using O = Ops<V>;
+    return {O::add(a.x, b.x), O::add(a.y, b.y), O::add(a.z, b.z)};
+}
+
+template <typename V>
+OPENXR_HPP_INLINE Vec3<V> negate(Vec3<V> const& v) noexcept {
+    using O = Ops<V>;
+    return {O::sub(O::splat(0.f), v.x), O::sub(O::splat(0.f), v.y), O::sub(O::splat(0.f), v.z)};
+}
+
+template <typename V>
+OPENXR_HPP_INLINE Vec3<V> cross(Vec3<V> const& a, Vec3<V> const& b) noexcept {
+    using O = Ops<V>;
+    return {O::sub(O::mul(a.y, b.z), O::mul(a.z, b.y)), O::sub(O::mul(a.z, b.x), O::mul(a.x, b.z)),
+            O::sub(O::mul(a.x, b.y), O::mul(a.y, b.x))};
+}
+
+template <typename V>
+OPENXR_HPP_INLINE Vec3<V> rotate(Quat<V> const& q, Vec3<V> const& v) noexcept {
+    using O = Ops<V>;
+    Vec3<V> u{q.x, q.y, q.z};
+    Vec3<V> t = cross(u, v);
+    t = {O::add(t.x, t.x), O::add(t.y, t.y), O::add(t.z, t.z)};
+    return add(add(v, Vec3<V>{O::mul(q.w, t.x), O::mul(q.w, t.y), O::mul(q.w, t.z)}), cross(u, t));
+}
+
+template <typename V>
+OPENXR_HPP_INLINE Quat<V> multiply(Quat<V> const& a, Quat<V> const& b) noexcept {
+    using O = Ops<V>;
+    return {O::add(O::add(O::mul(a.w, b.x), O::mul(a.x, b.w)), O::sub(O::mul(a.y, b.z), O::mul(a.z, b.y))),
+            O::add(O::sub(O::mul(a.w, b.y), O::mul(a.x, b.z)), O::add(O::mul(a.y, b.w), O::mul(a.z, b.x))),
+            O::add(O::add(O::mul(a.w, b.z), O::mul(a.x, b.y)), O::sub(O::mul(a.z, b.w), O::mul(a.y, b.x))),
+            O::sub(O::sub(O::mul(a.w, b.w), O::mul(a.x, b.x)), O::add(O::mul(a.y, b.y), O::mul(a.z, b.z)))};
+}
+
+template <typename V>
+OPENXR_HPP_INLINE Quat<V> conjugate(Quat<V> const& q) noexcept {
+    using O = Ops<V>;
+    return {O::sub(O::splat(0.f), q.x), O::sub(O::splat(0.f), q.y), O::sub(O::splat(0.f), q.z), q.w};
+}
+
+// Runs kernel.template run<V>(i) over [0, count): four lanes at a time, then one at a time for the remainder.
+template <typename Kernel>
+OPENXR_HPP_INLINE void forEachLane(size_t count, Kernel const& kernel) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        kernel.template run<f32x4>(i);
+    }
+    for (; i < count; ++i) {
+        kernel.template run<float>(i);
+    }
+}
+
+struct TransformPointsKernel {
+    Posef const& aFromB;
+    Vector3fSoA in;
+    Vector3fSoA out;
+    template <typename V>
+    void run(size_t i) const noexcept {
+        add(Vec3<V>::splat(aFromB.position), rotate(Quat<V>::splat(aFromB.orientation), Vec3<V>::load(in, i))).store(out, i);
+    }
+};
+
+struct RotateVectorsKernel {
+    Quaternionf const& rotation;
+    Vector3fSoA in;
+    Vector3fSoA out;
+    template <typename V>
+    void run(size_t i) const noexcept {
+        rotate(Quat<V>::splat(rotation), Vec3<V>::load(in, i)).store(out, i);
+    }
+};
+
+struct ComposePosesKernel {
+    Posef const& aFromB;
+    PosefSoA in;
+    PosefSoA out;
+    template <typename V>
+    void run(size_t i) const noexcept {
+        Quat<V> q = Quat<V>::splat(aFromB.orientation);
+        // Load everything before storing anything so in-place operation is safe.
+        Vec3<V> position = add(Vec3<V>::splat(aFromB.position), rotate(q, Vec3<V>::load(in.position, i)));
+        Quat<V> orientation = multiply(q, Quat<V>::load(in.orientation, i));
+        position.store(out.position, i);
+        orientation.store(out.orientation, i);
+    }
+};
+
+struct InversePosesKernel {
+    PosefSoA in;
+    PosefSoA out;
+    template <typename V>
+    void run(size_t i) const noexcept {
+        Quat<V> q = conjugate(Quat<V>::load(in.orientation, i));
+        Vec3<V> position = negate(rotate(q, Vec3<V>::load(in.position, i)));
+        position.store(out.position, i);
+        q.store(out.orientation, i);
+    }
+};
+template <typename V>
+OPENXR_HPP_INLINE V squaredLength(Vec3<V> const& a, Vec3<V> const& b) noexcept {
+    using O = Ops<V>;
+    V dx = O::sub(a.x, b.x);
+    V dy = O::sub(a.y, b.y);
+    V dz = O::sub(a.z, b.z);
+    return O::add(O::add(O::mul(dx, dx), O::mul(dy, dy)), O::mul(dz, dz));
+}
+
+struct SquaredDistancesFromKernel {
+    Vector3f const& from;
+    Vector3fSoA in;
+    float* out;
+    template <typename V>
+    void run(size_t i) const noexcept {
+        Ops<V>::store(out + i, squaredLength(Vec3<V>::load(in, i), Vec3<V>::splat(from)));
+    }
+};
+
+struct SquaredDistancesKernel {
+    Vector3fSoA a;
+    Vector3fSoA b;
+    float* out;
+    template <typename V>
+    void run(size_t i) const noexcept {
+        Ops<V>::store(out + i, squaredLength(Vec3<V>::load(a, i), Vec3<V>::load(b, i)));
+    }
+};
+}  // namespace simd
+}  // namespace impl
+
+/*!
+ * @name Batched operations on structure-of-arrays data
+ *
+ * Each function processes @p count elements, using SIMD for groups of four and scalar code for the remainder.
+ * The output may be the same arrays as the input (in-place operation), but must not otherwise overlap it.
+ * @{
+ */
+//! Transform @p count points by a single pose: `out[i] = transform(aFromB, in[i])`.
+OPENXR_HPP_INLINE void transformPoints(Posef const& aFromB, Vector3fSoA in, Vector3fSoA out, size_t count) noexcept {
+    impl::simd::forEachLane(count, impl::simd::TransformPointsKernel{aFromB, in, out});
+}
+
+//! Rotate @p count vectors by a single quaternion: `out[i] = rotate(rotation, in[i])`.
+OPENXR_HPP_INLINE void rotateVectors(Quaternionf const& rotation, Vector3fSoA in, Vector3fSoA out, size_t count) noexcept {
+    impl::simd::forEachLane(count, impl::simd::RotateVectorsKernel{rotation, in, out});
+}
+
+//! Compose a single pose with @p count poses: `out[i] = compose(aFromB, in[i])`.
+OPENXR_HPP_INLINE void composePoses(Posef const& aFromB, PosefSoA in, PosefSoA out, size_t count) noexcept {
+    impl::simd::forEachLane(count, impl::simd::ComposePosesKernel{aFromB, in, out});
+}
+
+//! Invert @p count poses: `out[i] = inverse(in[i])`.
+OPENXR_HPP_INLINE void inversePoses(PosefSoA in, PosefSoA out, size_t count) noexcept {
+    impl::simd::forEachLane(count, impl::simd::InversePosesKernel{in, out});
+}
+
+//! Squared distance from a single point to each of @p count points: `out[i] = |in[i] - from|^2`.
+OPENXR_HPP_INLINE void squaredDistances(Vector3f const& from, Vector3fSoA in, float* out, size_t count) noexcept {
+    impl::simd::forEachLane(count, impl::simd::SquaredDistancesFromKernel{from, in, out});
+}
+
+//! Element-wise squared distances between two sets of @p count points: `out[i] = |a[i] - b[i]|^2`.
+OPENXR_HPP_INLINE void squaredDistances(Vector3fSoA a, Vector3fSoA b, float* out, size_t count) noexcept {
+    impl::simd::forEachLane(count, impl::simd::SquaredDistancesKernel{a, b, out});
+}
+
+//! Scatter @p count vectors into structure-of-arrays form.
+OPENXR_HPP_INLINE void toSoA(Vector3f const* in, size_t count, Vector3fSoA out) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        out.x[i] = in[i].x;
+        out.y[i] = in[i].y;
+        out.z[i] = in[i].z;
+    }
+}
+
+//! Gather @p count vectors from structure-of-arrays form.
+OPENXR_HPP_INLINE void fromSoA(Vector3fSoA in, size_t count, Vector3f* out) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = Vector3f{in.x[i], in.y[i], in.z[i]};
+    }
+}
+
+//! Scatter @p count poses into structure-of-arrays form.
+OPENXR_HPP_INLINE void toSoA(Posef const* in, size_t count, PosefSoA out) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        out.orientation.x[i] = in[i].orientation.x;
+        out.orientation.y[i] = in[i].orientation.y;
+        out.orientation.z[i] = in[i].orientation.z;
+        out.orientation.w[i] = in[i].orientation.w;
+        out.position.x[i] = in[i].position.x;
+        out.position.y[i] = in[i].position.y;
+        out.position.z[i] = in[i].position.z;
+    }
+}
+
+//! Gather @p count poses from structure-of-arrays form.
+OPENXR_HPP_INLINE void fromSoA(PosefSoA in, size_t count, Posef* out) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = Posef{{in.orientation.x[i], in.orientation.y[i], in.orientation.z[i], in.orientation.w[i]},
+                       {in.position.x[i], in.position.y[i], in.position.z[i]}};
+    }
+}
+//! @}
+
+}  // namespace math
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
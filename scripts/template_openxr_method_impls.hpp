@@ -52,6 +52,10 @@
 #include "openxr_method_impls_enhanced_exceptions.inl"
 #endif  // !defined(OPENXR_HPP_NO_EXCEPTIONS)
 
+#if defined(OPENXR_HPP_EXPECTED)
+#include "openxr_method_impls_enhanced_expected.inl"
+#endif  // defined(OPENXR_HPP_EXPECTED)
+
 #endif  // !defined(OPENXR_HPP_DISABLE_ENHANCED_MODE)
 
 //# include('file_footer.hpp')
@@ -0,0 +1,310 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a per-instance, thread-safe cache of path/string conversions.
+ *
+ * @see xr::PathCache
+ * @ingroup utilities
+ */
+
+#include "openxr_atoms.hpp"
+#include "openxr_handles.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__has_include) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#if __has_include(<string_view>)
+#include <string_view>
+#if defined(__cpp_lib_string_view)
+#define OPENXR_HPP_HAS_STRING_VIEW
+#endif
+#endif
+#endif
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Caches `xrStringToPath` and `xrPathToString` for one instance, in both directions.
+ *
+ * Each string is copied once into an arena owned by the cache and never moves. So pathToString() can return a pointer
+ * to the interned, null-terminated string instead of allocating a `std::string`. Lookups are lock-free probes of two
+ * open-addressing tables (by string and by path). Only a miss takes a mutex, to ask the runtime and insert the result.
+ * Entries are never removed, since a path stays valid for the life of its instance.
+ *
+ * Once three quarters of @p Capacity slots are used, further strings are converted by the runtime uncached.
+ *
+ * @tparam Capacity Number of slots in each table: a power of two.
+ *
+ * @ingroup utilities
+ */
+template <size_t Capacity = 1024>
+class PathCache {
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+   public:
+    //! Create an empty cache for paths of @p instance.
+    explicit PathCache(Instance instance) : instance_(instance) {}
+    PathCache(PathCache const&) = delete;
+    PathCache& operator=(PathCache const&) = delete;
+
+    /*!
+     * @brief Convert the @p length characters at @p str to a path, asking the runtime only the first time.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result stringToPath(const char* str, size_t length, Path& path, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        const uint64_t hash = hashString(str, length);
+        if (Entry const* entry = findString(hash, str, length)) {
+            path = Path{entry->path};
+            return Result::Success;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (Entry const* entry = findString(hash, str, length)) {
+            path = Path{entry->path};
+            return Result::Success;
+        }
+        XrPath raw = XR_NULL_PATH;
+        if (full()) {
+            XrResult result = d.xrStringToPath(instance_.get(), std::string(str, length).c_str(), &raw);
+            path = Path{raw};
+            return static_cast<Result>(result);
+        }
+        // xrStringToPath needs a null-terminated string: intern first, then ask.
+        const char* interned = internString(str, length);
+        XrResult result = d.xrStringToPath(instance_.get(), interned, &raw);
+        if (XR_FAILED(result)) {
+            unintern(length);
+            return static_cast<Result>(result);
+        }
+        insert(raw, interned, length, hash);
+        path = Path{raw};
+        return static_cast<Result>(result);
+    }
+
+    //! Convert a null-terminated string to a path.
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result stringToPath(const char* str, Path& path, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        return stringToPath(str, std::strlen(str), path, d);
+    }
+
+    //! Convert a `std::string` to a path.
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result stringToPath(std::string const& str, Path& path, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        return stringToPath(str.data(), str.size(), path, d);
+    }
+
+#ifdef OPENXR_HPP_HAS_STRING_VIEW
+    //! Convert a `std::string_view` to a path.
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result stringToPath(std::string_view str, Path& path, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        return stringToPath(str.data(), str.size(), path, d);
+    }
+#endif  // OPENXR_HPP_HAS_STRING_VIEW
+
+    /*!
+     * @brief Convert a path to its string, asking the runtime only the first time.
+     *
+     * On success, @p str points to a null-terminated string owned by the cache, valid for the cache's lifetime.
+     *
+     * @returns Result::ErrorLimitReached for an uncached path once the cache is full, since there is nowhere to keep
+     * the string.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result pathToString(Path path, const char*& str, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        if (Entry const* entry = findPath(path.get())) {
+            str = entry->str;
+            return Result::Success;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (Entry const* entry = findPath(path.get())) {
+            str = entry->str;
+            return Result::Success;
+        }
+        if (full()) {
+            return Result::ErrorLimitReached;
+        }
+        char buffer[XR_MAX_PATH_LENGTH];
+        uint32_t count = 0;
+        XrResult result = d.xrPathToString(instance_.get(), path.get(), XR_MAX_PATH_LENGTH, &count, buffer);
+        if (XR_FAILED(result)) {
+            return static_cast<Result>(result);
+        }
+        // count includes the null terminator.
+        const size_t length = count > 0 ? count - 1 : 0;
+        const char* interned = internString(buffer, length);
+        insert(path.get(), interned, length, hashString(interned, length));
+        str = interned;
+        return static_cast<Result>(result);
+    }
+
+    /*!
+     * @brief Convert each of @p count null-terminated strings, so later lookups of them never reach the runtime.
+     *
+     * @returns Result::Success, or the first failing result.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result prepopulate(const char* const* strings, size_t count, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        Result firstFailure = Result::Success;
+        for (size_t i = 0; i < count; ++i) {
+            Path path;
+            Result result = stringToPath(strings[i], path, d);
+            if (failed(result) && !failed(firstFailure)) {
+                firstFailure = result;
+            }
+        }
+        return firstFailure;
+    }
+
+    //! The instance whose paths are cached.
+    Instance instance() const noexcept { return instance_; }
+
+    //! Number of cached paths.
+    size_t size() const noexcept { return size_.load(std::memory_order_relaxed); }
+
+   private:
+    struct Entry {
+        XrPath path;
+        const char* str;
+        size_t length;
+        uint64_t hash;
+    };
+
+    static const size_t blockSize = 4096;
+    static const size_t maxEntries = Capacity / 4 * 3;
+
+    static uint64_t hashString(const char* str, size_t length) noexcept {
+        // FNV-1a
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (size_t i = 0; i < length; ++i) {
+            hash = (hash ^ static_cast<unsigned char>(str[i])) * 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    static size_t hashPath(XrPath path) noexcept {
+        uint64_t h = path * 0x9e3779b97f4a7c15ull;
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+
+    Entry const* findString(uint64_t hash, const char* str, size_t length) const noexcept {
+        for (size_t probe = 0; probe < Capacity; ++probe) {
+            Entry const* entry = byString_[(hash + probe) & (Capacity - 1)].load(std::memory_order_acquire);
+            if (entry == nullptr) {
+                return nullptr;
+            }
+            if (entry->hash == hash && entry->length == length && std::memcmp(entry->str, str, length) == 0) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    Entry const* findPath(XrPath path) const noexcept {
+        const size_t start = hashPath(path);
+        for (size_t probe = 0; probe < Capacity; ++probe) {
+            Entry const* entry = byPath_[(start + probe) & (Capacity - 1)].load(std::memory_order_acquire);
+            if (entry == nullptr) {
+                return nullptr;
+            }
+            if (entry->path == path) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    bool full() const noexcept { return size_.load(std::memory_order_relaxed) >= maxEntries; }
+
+    // Requires mutex_. Copies the string into the arena, null-terminated.
+    const char* internString(const char* str, size_t length) {
+        if (blocks_.empty() || blockUsed_ + length + 1 > blockSize) {
+            blocks_.emplace_back(new char[length + 1 > blockSize ? length + 1 : blockSize]);
+            blockUsed_ = 0;
+        }
+        char* dest = blocks_.back().get() + blockUsed_;
+        std::memcpy(dest, str, length);
+        dest[length] = '\0';
+        blockUsed_ += length + 1;
+        return dest;
+    }
+
+    // Requires mutex_. Gives back the most recently interned string.
+    void unintern(size_t length) noexcept { blockUsed_ -= length + 1; }
+
+    // Requires mutex_ and !full(). Publishes the entry to both tables.
+    void insert(XrPath path, const char* str, size_t length, uint64_t hash) {
+        const size_t size = size_.load(std::memory_order_relaxed);
+        entries_.push_back(Entry{path, str, length, hash});
+        Entry const* entry = &entries_.back();
+        publish(byString_, hash, entry);
+        // A path may already be cached via another spelling that the runtime accepted.
+        if (findPath(path) == nullptr) {
+            publish(byPath_, hashPath(path), entry);
+        }
+        size_.store(size + 1, std::memory_order_relaxed);
+    }
+
+    static void publish(std::atomic<Entry const*> (&table)[Capacity], uint64_t start, Entry const* entry) noexcept {
+        for (size_t probe = 0;; ++probe) {
+            std::atomic<Entry const*>& slot = table[(start + probe) & (Capacity - 1)];
+            if (slot.load(std::memory_order_relaxed) == nullptr) {
+                slot.store(entry, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    Instance instance_;
+    std::atomic<Entry const*> byString_[Capacity] = {};
+    std::atomic<Entry const*> byPath_[Capacity] = {};
+    std::atomic<size_t> size_{0};
+    std::mutex mutex_;
+    std::deque<Entry> entries_;
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    size_t blockUsed_ = 0;
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
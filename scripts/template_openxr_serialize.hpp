@@ -0,0 +1,667 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a compact binary serialization of projected structs, for recording sessions and sending state
+ * between processes.
+ *
+ * Values are written field by field, little-endian, with nested structs inline and `next` chains tagged by their
+ * structure type. Structs without padding whose members are all plain values are copied in one piece on
+ * little-endian hosts.
+ * Kept apart from openxr_structs.hpp, since serializing hundreds of structs adds to the time to compile it.
+ *
+ * @ingroup utilities
+ */
+
+#include "openxr_structs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+//# include('define_inline_constexpr.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+#ifndef OPENXR_HPP_LITTLE_ENDIAN
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define OPENXR_HPP_LITTLE_ENDIAN 0
+#else
+#define OPENXR_HPP_LITTLE_ENDIAN 1
+#endif
+#endif  // !OPENXR_HPP_LITTLE_ENDIAN
+
+namespace OPENXR_HPP_NAMESPACE {
+
+//! Implementation details
+namespace impl {
+
+//! Writes serialized bytes into a caller-provided buffer, counting the bytes that did not fit.
+class SerialWriter {
+   public:
+    SerialWriter(void* buffer, size_t capacity) noexcept
+        : m_buffer(static_cast<unsigned char*>(buffer)), m_capacity(capacity) {}
+
+    //! Appends @p size bytes if they fit. Once some do not, nothing more fits until a rewind(), but the size keeps
+    //! growing.
+    void write(const void* data, size_t size) noexcept {
+        if (m_size <= m_capacity && size <= m_capacity - m_size) {
+            memcpy(m_buffer + m_size, data, size);
+        }
+        m_size += size;
+    }
+
+    //! Appends the low @p size bytes of @p value, least significant first.
+    void writeInteger(uint64_t value, size_t size) noexcept {
+        unsigned char bytes[8];
+#if OPENXR_HPP_LITTLE_ENDIAN
+        memcpy(bytes, &value, sizeof(bytes));
+#else
+        for (size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+#endif
+        write(bytes, size);
+    }
+
+    //! Appends @p value seven bits at a time, so that small values such as lengths take a single byte.
+    void writeVarint(uint64_t value) noexcept {
+        unsigned char bytes[10];
+        size_t size = 0;
+        for (; value >= 0x80; value >>= 7) {
+            bytes[size++] = static_cast<unsigned char>(value | 0x80);
+        }
+        bytes[size++] = static_cast<unsigned char>(value);
+        write(bytes, size);
+    }
+
+    //! Overwrites four bytes written earlier at @p position, such as a length only known afterwards.
+    void patchUint32(size_t position, uint32_t value) noexcept {
+        if (position <= m_capacity && 4 <= m_capacity - position) {
+            for (size_t i = 0; i < 4; ++i) {
+                m_buffer[position + i] = static_cast<unsigned char>(value >> (8 * i));
+            }
+        }
+    }
+
+    //! Drops the bytes written since the size was @p size, so that those written next land there.
+    void rewind(size_t size) noexcept { m_size = size; }
+
+    //! The bytes written so far, or that would have been had they fit.
+    size_t size() const noexcept { return m_size; }
+
+   private:
+    unsigned char* m_buffer;
+    size_t m_capacity;
+    size_t m_size = 0;
+};
+
+//! Reads serialized bytes, failing once anything would be read past the end.
+class SerialReader {
+   public:
+    SerialReader(const void* data, size_t size) noexcept : m_data(static_cast<const unsigned char*>(data)), m_size(size) {}
+
+    //! Copies the next @p size bytes into @p data, or zeros and fails if there are not that many left.
+    void read(void* data, size_t size) noexcept {
+        if (size <= m_size - m_position) {
+            memcpy(data, m_data + m_position, size);
+            m_position += size;
+        } else {
+            memset(data, 0, size);
+            fail();
+        }
+    }
+
+    //! Reads an integer of @p size bytes, least significant first.
+    uint64_t readInteger(size_t size) noexcept {
+        unsigned char bytes[8] = {};
+        read(bytes, size);
+#if OPENXR_HPP_LITTLE_ENDIAN
+        uint64_t value;
+        memcpy(&value, bytes, sizeof(value));
+#else
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; ++i) {
+            value |= uint64_t(bytes[i]) << (8 * i);
+        }
+#endif
+        return value;
+    }
+
+    uint64_t readVarint() noexcept {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (m_position == m_size) {
+                break;
+            }
+            const unsigned char byte = m_data[m_position++];
+            value |= uint64_t(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        fail();
+        return 0;
+    }
+
+    //! Splits off the next @p size bytes into a reader of their own.
+    SerialReader sub(size_t size) noexcept {
+        if (size > m_size - m_position) {
+            fail();
+            return SerialReader{nullptr, 0};
+        }
+        SerialReader reader{m_data + m_position, size};
+        m_position += size;
+        return reader;
+    }
+
+    void fail() noexcept {
+        m_position = m_size;
+        m_failed = true;
+    }
+
+    bool failed() const noexcept { return m_failed; }
+
+    size_t position() const noexcept { return m_position; }
+
+   private:
+    const unsigned char* m_data;
+    size_t m_size;
+    size_t m_position = 0;
+    bool m_failed = false;
+};
+
+//! Whether values of T are serialized as their own bytes, so that on little-endian hosts they may be copied whole.
+template <typename T>
+struct IsFlat : std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_enum<T>::value> {};
+
+template <typename T, size_t N>
+struct IsFlat<T[N]> : IsFlat<T> {};
+
+template <typename BitType, typename MaskType>
+struct IsFlat<Flags<BitType, MaskType>> : std::true_type {};
+
+//# for type in ["Bool32", "Time", "Duration", "Version"] + (gen.dict_atoms.keys() | map("replace", "Xr", "") | list)
+template <>
+struct IsFlat</*{ type }*/> : std::true_type {};
+//# endfor
+
+//## On 64-bit platforms, a raw handle pointer is stored the same as the 64-bit integer it is written as.
+//# for handle in gen.api_handles
+/*{ protect_begin(handle) }*/
+template <>
+struct IsFlat</*{ project_type_name(handle.name) }*/> : std::integral_constant<bool, sizeof(/*{ project_type_name(handle.name) }*/) == 8> {};
+/*{ protect_end(handle) }*/
+//# endfor
+
+/*!
+ * @defgroup serialization Serialization
+ * @brief Overloads of `serialValue()` and `deserialValue()` for each serialized type, found by argument-dependent
+ * lookup on SerialWriter and SerialReader.
+ * @{
+ */
+
+template <typename T>
+OPENXR_HPP_INLINE typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type serialValue(
+    SerialWriter& out, T value) noexcept {
+    out.writeInteger(static_cast<uint64_t>(value), sizeof(T));
+}
+
+template <typename T>
+OPENXR_HPP_INLINE typename std::enable_if<std::is_integral<T>::value>::type deserialValue(SerialReader& in,
+                                                                                          T& value) noexcept {
+    value = static_cast<T>(in.readInteger(sizeof(T)));
+}
+
+template <typename T>
+OPENXR_HPP_INLINE typename std::enable_if<std::is_enum<T>::value>::type deserialValue(SerialReader& in,
+                                                                                      T& value) noexcept {
+    value = static_cast<T>(static_cast<typename std::underlying_type<T>::type>(in.readInteger(sizeof(T))));
+}
+
+OPENXR_HPP_INLINE void serialValue(SerialWriter& out, float value) noexcept {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    out.writeInteger(bits, sizeof(bits));
+}
+
+OPENXR_HPP_INLINE void deserialValue(SerialReader& in, float& value) noexcept {
+    const uint32_t bits = static_cast<uint32_t>(in.readInteger(sizeof(bits)));
+    memcpy(&value, &bits, sizeof(value));
+}
+
+OPENXR_HPP_INLINE void serialValue(SerialWriter& out, double value) noexcept {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    out.writeInteger(bits, sizeof(bits));
+}
+
+OPENXR_HPP_INLINE void deserialValue(SerialReader& in, double& value) noexcept {
+    const uint64_t bits = in.readInteger(sizeof(bits));
+    memcpy(&value, &bits, sizeof(value));
+}
+
+//! Pointers other than `next` are not followed, since what they point to and how much of it is not known here.
+//! Nothing is written for them, and they are left unchanged when reading.
+//! Taken by reference, so that arrays are not converted to pointers and are serialized by element instead.
+template <typename T>
+OPENXR_HPP_INLINE void serialValue(SerialWriter&, T* const&) noexcept {}
+
+template <typename T>
+OPENXR_HPP_INLINE void deserialValue(SerialReader&, T*&) noexcept {}
+
+template <typename T>
+OPENXR_HPP_INLINE auto serialMember(SerialWriter& out, T const& value, int) noexcept
+    -> decltype(serialValue(out, value)) {
+    serialValue(out, value);
+}
+
+//! Members of platform types, such as `LUID`, as their bytes in host order.
+template <typename T>
+OPENXR_HPP_INLINE void serialMember(SerialWriter& out, T const& value, long) noexcept {
+    out.write(&value, sizeof(T));
+}
+
+template <typename T>
+OPENXR_HPP_INLINE auto deserialMember(SerialReader& in, T& value, int) noexcept -> decltype(deserialValue(in, value)) {
+    deserialValue(in, value);
+}
+
+template <typename T>
+OPENXR_HPP_INLINE void deserialMember(SerialReader& in, T& value, long) noexcept {
+    in.read(&value, sizeof(T));
+}
+
+template <typename T, size_t N>
+OPENXR_HPP_INLINE void serialValue(SerialWriter& out, T const (&values)[N]) noexcept {
+    if (OPENXR_HPP_LITTLE_ENDIAN && IsFlat<T>::value) {
+        out.write(values, sizeof(values));
+        return;
+    }
+    for (size_t i = 0; i < N; ++i) {
+        serialMember(out, values[i], 0);
+    }
+}
+
+template <typename T, size_t N>
+OPENXR_HPP_INLINE void deserialValue(SerialReader& in, T (&values)[N]) noexcept {
+    if (OPENXR_HPP_LITTLE_ENDIAN && IsFlat<T>::value) {
+        in.read(values, sizeof(values));
+        return;
+    }
+    for (size_t i = 0; i < N; ++i) {
+        deserialMember(in, values[i], 0);
+    }
+}
+
+//! Fixed-size strings as their length then their characters, without the unused tail.
+template <size_t N>
+OPENXR_HPP_INLINE void serialFixedString(SerialWriter& out, const char (&text)[N]) noexcept {
+    const size_t length = strnlen(text, N - 1);
+    out.writeVarint(length);
+    out.write(text, length);
+}
+
+template <size_t N>
+OPENXR_HPP_INLINE void deserialFixedString(SerialReader& in, char (&text)[N]) noexcept {
+    const uint64_t length = in.readVarint();
+    if (length >= N) {
+        in.fail();
+    }
+    const size_t copied = in.failed() ? 0 : static_cast<size_t>(length);
+    in.read(text, copied);
+    memset(text + copied, 0, N - copied);
+}
+
+template <typename BitType, typename MaskType>
+OPENXR_HPP_INLINE void serialValue(SerialWriter& out, Flags<BitType, MaskType> const& flags) noexcept {
+    serialValue(out, flags.get());
+}
+
+template <typename BitType, typename MaskType>
+OPENXR_HPP_INLINE void deserialValue(SerialReader& in, Flags<BitType, MaskType>& flags) noexcept {
+    MaskType mask;
+    deserialValue(in, mask);
+    flags = Flags<BitType, MaskType>{mask};
+}
+
+//! Wrappers of raw values, as the value they wrap.
+template <typename T>
+OPENXR_HPP_INLINE void serialWrapped(SerialWriter& out, T const& value) noexcept {
+    serialValue(out, value.get());
+}
+
+template <typename T>
+OPENXR_HPP_INLINE void deserialWrapped(SerialReader& in, T& value) noexcept {
+    deserialValue(in, *value.put());
+}
+
+//# for type in ["Bool32", "Time", "Duration", "Version"] + (gen.dict_atoms.keys() | map("replace", "Xr", "") | list)
+OPENXR_HPP_INLINE void serialValue(SerialWriter& out, /*{ type }*/ const& value) noexcept { serialWrapped(out, value); }
+
+OPENXR_HPP_INLINE void deserialValue(SerialReader& in, /*{ type }*/& value) noexcept { deserialWrapped(in, value); }
+
+//# endfor
+//## Raw handles are pointers on 64-bit platforms and integers elsewhere; both are written as 64-bit integers.
+template <typename T>
+OPENXR_HPP_INLINE void serialRawHandle(SerialWriter& out, T* handle) noexcept {
+    out.writeInteger(reinterpret_cast<uintptr_t>(handle), 8);
+}
+
+OPENXR_HPP_INLINE void serialRawHandle(SerialWriter& out, uint64_t handle) noexcept {
+    out.writeInteger(handle, 8);
+}
+
+template <typename T>
+OPENXR_HPP_INLINE void deserialRawHandle(SerialReader& in, T*& handle) noexcept {
+    handle = reinterpret_cast<T*>(static_cast<uintptr_t>(in.readInteger(8)));
+}
+
+OPENXR_HPP_INLINE void deserialRawHandle(SerialReader& in, uint64_t& handle) noexcept {
+    handle = in.readInteger(8);
+}
+
+//# for handle in gen.api_handles
+/*{ protect_begin(handle) }*/
+OPENXR_HPP_INLINE void serialValue(SerialWriter& out, /*{ project_type_name(handle.name) }*/ const& value) noexcept {
+    serialRawHandle(out, value.get());
+}
+
+OPENXR_HPP_INLINE void deserialValue(SerialReader& in, /*{ project_type_name(handle.name) }*/& value) noexcept {
+    deserialRawHandle(in, *value.put());
+}
+/*{ protect_end(handle) }*/
+//# endfor
+
+//## Declared first, since structs contain other structs, and typed structs are reached through next chains.
+//# for struct in gen.api_structures if struct.name not in manually_projected
+/*{ protect_begin(struct) }*/
+inline void serialValue(SerialWriter& out, /*{ project_type_name(struct.name) }*/ const& value) noexcept;
+inline void deserialValue(SerialReader& in, /*{ project_type_name(struct.name) }*/& value) noexcept;
+/*{ protect_end(struct) }*/
+//# endfor
+
+//! Writes the members of the typed struct at @p value, other than type and next, or returns false if @p type is not
+//! one this header knows.
+inline bool serialTypedMembers(SerialWriter& out, StructureType type, const void* value) noexcept;
+
+//! Reads the members of the typed struct at @p value, other than type and next, or returns false if @p type is not
+//! one this header knows.
+inline bool deserialTypedMembers(SerialReader& in, StructureType type, void* value) noexcept;
+
+//## Padding is not serialized, so only structs without it are copied whole. Fixed-size strings are written by length.
+//# for struct in gen.api_structures if struct.name not in manually_projected and not project_struct(struct).typed_struct
+//#     set s = project_struct(struct)
+/*{ protect_begin(struct) }*/
+//#     if struct.members | selectattr('type', 'equalto', 'char') | selectattr('is_array') | rejectattr('pointer_count') | list
+template <>
+struct IsFlat</*{ s.cpp_name }*/> : std::false_type {};
+//#     else
+template <>
+struct IsFlat</*{ s.cpp_name }*/>
+    : std::integral_constant<bool,
+//#     for member in struct.members
+                             IsFlat<decltype(/*{ s.cpp_name }*/::/*{ member.name }*/)>::value &&
+//#     endfor
+                             sizeof(/*{ s.cpp_name }*/) == /*% for member in struct.members %*/sizeof(/*{ s.cpp_name }*/::/*{ member.name }*/)/*{ " + " if not loop.last }*//*% endfor %*/> {};
+//#     endif
+/*{ protect_end(struct) }*/
+//# endfor
+
+//! Writes the structs of a next chain that this header knows, each as its type, its length, then its members, and
+//! ends with a zero type.
+inline void serialChain(SerialWriter& out, const void* next) noexcept {
+    for (auto item = static_cast<const XrBaseInStructure*>(next); item != nullptr; item = item->next) {
+        const size_t start = out.size();
+        out.writeVarint(static_cast<uint32_t>(item->type));
+        const size_t lengthPosition = out.size();
+        out.writeInteger(0, 4);
+        if (serialTypedMembers(out, static_cast<StructureType>(item->type), item)) {
+            out.patchUint32(lengthPosition, static_cast<uint32_t>(out.size() - lengthPosition - 4));
+        } else {
+            out.rewind(start);
+        }
+    }
+    out.writeVarint(0);
+}
+
+//! Reads a next chain into the structs of the same type already chained to the destination, in place, skipping those
+//! it does not have.
+inline void deserialChain(SerialReader& in, const void* next) noexcept {
+    for (;;) {
+        const auto type = static_cast<StructureType>(in.readVarint());
+        if (in.failed() || type == StructureType::Unknown) {
+            return;
+        }
+        SerialReader item = in.sub(static_cast<size_t>(in.readInteger(4)));
+        auto dest = static_cast<const XrBaseInStructure*>(next);
+        while (dest != nullptr && static_cast<StructureType>(dest->type) != type) {
+            dest = dest->next;
+        }
+        if (dest != nullptr) {
+            deserialTypedMembers(item, type, const_cast<XrBaseInStructure*>(dest));
+            if (item.failed()) {
+                in.fail();
+            }
+        }
+    }
+}
+
+//# macro serial_members(members)
+//#     for member in members
+//#         if is_static_length_string(member)
+    serialFixedString(out, value./*{ member.name }*/);
+//#         else
+    serialMember(out, value./*{ member.name }*/, 0);
+//#         endif
+//#     else
+    (void)out;
+    (void)value;
+//#     endfor
+//# endmacro
+//# macro deserial_members(members)
+//#     for member in members
+//#         if is_static_length_string(member)
+    deserialFixedString(in, value./*{ member.name }*/);
+//#         else
+    deserialMember(in, value./*{ member.name }*/, 0);
+//#         endif
+//#     else
+    (void)in;
+    (void)value;
+//#     endfor
+//# endmacro
+
+//# for struct in gen.api_structures if struct.name not in manually_projected
+//#     set s = project_struct(struct)
+//#     set members = struct.members | reject('cpp_hidden_member') | list
+/*{ protect_begin(struct) }*/
+//#     if not s.typed_struct
+inline void serialValue(SerialWriter& out, /*{ s.cpp_name }*/ const& value) noexcept {
+    if (OPENXR_HPP_LITTLE_ENDIAN && IsFlat</*{ s.cpp_name }*/>::value) {
+        out.write(&value, sizeof(value));
+        return;
+    }
+/*{ serial_members(members).rstrip("\n") }*/
+}
+
+inline void deserialValue(SerialReader& in, /*{ s.cpp_name }*/& value) noexcept {
+    if (OPENXR_HPP_LITTLE_ENDIAN && IsFlat</*{ s.cpp_name }*/>::value) {
+        in.read(&value, sizeof(value));
+        return;
+    }
+/*{ deserial_members(members).rstrip("\n") }*/
+}
+//#     else
+inline void serialMembers(SerialWriter& out, /*{ s.cpp_name }*/ const& value) noexcept {
+/*{ serial_members(members).rstrip("\n") }*/
+}
+
+inline void deserialMembers(SerialReader& in, /*{ s.cpp_name }*/& value) noexcept {
+/*{ deserial_members(members).rstrip("\n") }*/
+}
+
+//#         if s.is_abstract
+//! Written as its type, then the members of the struct it is the header of, then its next chain.
+inline void serialValue(SerialWriter& out, /*{ s.cpp_name }*/ const& value) noexcept {
+    out.writeVarint(static_cast<uint32_t>(value.type));
+    if (!serialTypedMembers(out, value.type, &value)) {
+        serialMembers(out, value);
+    }
+    serialChain(out, value.next);
+}
+
+//! Fails unless the type of @p value, which tells which struct it is the header of, is the one that was written.
+inline void deserialValue(SerialReader& in, /*{ s.cpp_name }*/& value) noexcept {
+    if (in.readVarint() != static_cast<uint32_t>(value.type)) {
+        in.fail();
+        return;
+    }
+    if (!deserialTypedMembers(in, value.type, &value)) {
+        deserialMembers(in, value);
+    }
+    deserialChain(in, value.next);
+}
+//#         else
+inline void serialValue(SerialWriter& out, /*{ s.cpp_name }*/ const& value) noexcept {
+    serialMembers(out, value);
+    serialChain(out, value.next);
+}
+
+inline void deserialValue(SerialReader& in, /*{ s.cpp_name }*/& value) noexcept {
+    deserialMembers(in, value);
+    deserialChain(in, value.next);
+}
+//#         endif
+//#     endif
+/*{ protect_end(struct) }*/
+//# endfor
+
+//! Written as the type of the event it holds, then the members of that event, then its next chain.
+inline void serialValue(SerialWriter& out, EventDataBuffer const& value) noexcept {
+    out.writeVarint(static_cast<uint32_t>(value.type));
+    serialTypedMembers(out, value.type, &value);
+    serialChain(out, value.next);
+}
+
+//! Takes on the type of the event that was written, and fails if it is not one this header knows.
+inline void deserialValue(SerialReader& in, EventDataBuffer& value) noexcept {
+    const auto type = static_cast<StructureType>(in.readVarint());
+    value.type = type;
+    if (!deserialTypedMembers(in, type, &value)) {
+        in.fail();
+        return;
+    }
+    deserialChain(in, value.next);
+}
+
+inline bool serialTypedMembers(SerialWriter& out, StructureType type, const void* value) noexcept {
+    switch (type) {
+//# for struct in gen.api_structures if struct.name not in manually_projected and project_struct(struct).has_type_enum_value
+//#     set s = project_struct(struct)
+/*{ protect_begin(struct) }*/
+        case /*{ s.struct_type_enum }*/:
+            serialMembers(out, *static_cast</*{ s.cpp_name }*/ const*>(value));
+            return true;
+/*{ protect_end(struct) }*/
+//# endfor
+        default:
+            return false;
+    }
+}
+
+inline bool deserialTypedMembers(SerialReader& in, StructureType type, void* value) noexcept {
+    switch (type) {
+//# for struct in gen.api_structures if struct.name not in manually_projected and project_struct(struct).has_type_enum_value
+//#     set s = project_struct(struct)
+/*{ protect_begin(struct) }*/
+        case /*{ s.struct_type_enum }*/:
+            deserialMembers(in, *static_cast</*{ s.cpp_name }*/*>(value));
+            return true;
+/*{ protect_end(struct) }*/
+//# endfor
+        default:
+            return false;
+    }
+}
+
+//! @}
+
+}  // namespace impl
+
+/*!
+ * @brief Serializes @p value into @p buffer, member by member, without allocating.
+ *
+ * Integers, enums, floating-point numbers, atoms and handles are written at their own width, little-endian. Nested
+ * structs and fixed-size arrays are written inline, and fixed-size strings as their length then their characters.
+ * The structs of a `next` chain that this header knows are written after the members, each tagged with its type.
+ * Other pointers are not followed, and nothing is written for them.
+ *
+ * @return The size of the serialized value. If it is larger than @p size, the contents of @p buffer are incomplete:
+ * call again with a buffer at least that large.
+ * @ingroup utilities
+ */
+template <typename T>
+OPENXR_HPP_INLINE auto serialize(void* buffer, size_t size, T const& value) noexcept
+    -> decltype(serialValue(std::declval<impl::SerialWriter&>(), value), size_t()) {
+    impl::SerialWriter out(buffer, size);
+    serialValue(out, value);
+    return out.size();
+}
+
+/*!
+ * @brief Reads a value written by serialize() from @p data into @p value.
+ *
+ * Members are read in place: `type`, `next` and pointers other than `next` are left as they are. The structs of the
+ * serialized `next` chain are read into those of the same type already chained to @p value, which must be
+ * modifiable, and are skipped if it has none. Base structs and EventDataBuffer are read as the struct they hold.
+ *
+ * @param consumed If not null, receives the number of bytes read.
+ * @return false if @p data is truncated or malformed, or holds a different struct than the type of @p value names.
+ * @ingroup utilities
+ */
+template <typename T>
+OPENXR_HPP_INLINE auto deserialize(const void* data, size_t size, T& value, size_t* consumed = nullptr) noexcept
+    -> decltype(deserialValue(std::declval<impl::SerialReader&>(), value), bool()) {
+    impl::SerialReader in(data, size);
+    deserialValue(in, value);
+    if (consumed != nullptr) {
+        *consumed = in.position();
+    }
+    return !in.failed();
+}
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
@@ -0,0 +1,310 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a per-frame cache of space locations, shared by concurrent callers.
+ *
+ * @see xr::SpaceLocator
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+#include "openxr_method_impls.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Caches the results of Space::locateSpace() for the current frame.
+ *
+ * Rendering, physics, audio and UI code often locate the same space against the same base space
+ * at the same predicted display time. The first such call in a frame reaches the runtime, and the rest are
+ * answered from a fixed-size open-addressing table.
+ *
+ * The cache is keyed on the `(space, baseSpace)` pair and holds results for a single Time: calling locate() with a later
+ * time starts a new frame and implicitly discards everything cached for the previous one. Calls with an earlier time
+ * than the current frame, calls whose SpaceLocation has a `next` chain, and calls that find the table full are passed
+ * straight through to the runtime.
+ *
+ * All member functions may be called concurrently from any number of threads. Lookups take no locks; only the first call
+ * with a new time briefly takes a mutex. Two threads missing on the same key at the same moment may both call the runtime.
+ *
+ * @tparam Capacity Number of table slots: a power of two, comfortably more than the distinct pairs located per frame.
+ *
+ * @ingroup utilities
+ */
+template <size_t Capacity = 64>
+class SpaceLocator {
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+   public:
+    //! A pair of spaces to locate, for locateAll().
+    struct Query {
+        Space space;
+        Space baseSpace;
+    };
+
+    //! Counters of how calls were answered since construction or the last resetStats().
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        //! Calls that could not use the cache: stale time, `next` chain, full table, or a failed locate.
+        uint64_t bypasses;
+    };
+
+    SpaceLocator() = default;
+    SpaceLocator(SpaceLocator const&) = delete;
+    SpaceLocator& operator=(SpaceLocator const&) = delete;
+
+    /*!
+     * @brief Locate @p space relative to @p baseSpace at @p time, using the cached result if there is one.
+     *
+     * Only successful results are cached.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result locate(Space space, Space baseSpace, Time time, SpaceLocation& location,
+                  Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        uint64_t generation = 0;
+        if (location.next != nullptr || !frameGeneration(time, generation)) {
+            return passThrough(space, baseSpace, time, location, d);
+        }
+        const uint64_t spaceKey = keyOf(space.get());
+        const uint64_t baseKey = keyOf(baseSpace.get());
+        const size_t start = hash(spaceKey, baseKey);
+        for (size_t probe = 0; probe < Capacity; ++probe) {
+            Slot& slot = slots_[(start + probe) & (Capacity - 1)];
+            uint64_t tag = slot.tag.load(std::memory_order_acquire);
+            while (true) {
+                const uint64_t slotGeneration = tag & ~stateBits;
+                if (slotGeneration > generation) {
+                    // Another caller has moved on to a later frame.
+                    return passThrough(space, baseSpace, time, location, d);
+                }
+                if (slotGeneration == generation) {
+                    if ((tag & readyBit) != 0 && slot.read(tag, spaceKey, baseKey, location)) {
+                        hits_.fetch_add(1, std::memory_order_relaxed);
+                        return Result::Success;
+                    }
+                    // Another key, or one still being located: keep probing.
+                    break;
+                }
+                if ((tag & writingBit) != 0) {
+                    // Still being filled by a caller from an earlier frame, which owns it until it is done.
+                    break;
+                }
+                // Left over from an earlier frame, so free for this one. A failed exchange reloads the tag.
+                if (slot.tag.compare_exchange_weak(tag, generation | writingBit, std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+                    return fill(slot, tag, generation, space, baseSpace, time, location, d);
+                }
+            }
+        }
+        return passThrough(space, baseSpace, time, location, d);
+    }
+
+    /*!
+     * @brief Locate several space pairs at the same time in one pass, filling `locations[i]` for `queries[i]`.
+     *
+     * Every query is attempted.
+     *
+     * @returns Result::Success, or the first failing result.
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result locateAll(Time time, Query const* queries, SpaceLocation* locations, size_t count,
+                     Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) {
+        Result firstFailure = Result::Success;
+        for (size_t i = 0; i < count; ++i) {
+            Result result = locate(queries[i].space, queries[i].baseSpace, time, locations[i], d);
+            if (failed(result) && !failed(firstFailure)) {
+                firstFailure = result;
+            }
+        }
+        return firstFailure;
+    }
+
+    //! Discard all cached results, for example after destroying a space that may be cached.
+    void clear() {
+        std::lock_guard<std::mutex> lock(frameMutex_);
+        beginFrame(std::numeric_limits<XrTime>::min());
+    }
+
+    //! Snapshot of the hit, miss and bypass counters.
+    Stats stats() const noexcept {
+        return {hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed),
+                bypasses_.load(std::memory_order_relaxed)};
+    }
+
+    //! Reset the counters to zero.
+    void resetStats() noexcept {
+        hits_.store(0, std::memory_order_relaxed);
+        misses_.store(0, std::memory_order_relaxed);
+        bypasses_.store(0, std::memory_order_relaxed);
+    }
+
+   private:
+    // Frame generations are multiples of four. The low bits of a slot tag mark it as claimed by a caller that is
+    // writing its result, or as holding a result ready to read; a slot with neither is free for a later frame.
+    static const uint64_t readyBit = 1;
+    static const uint64_t writingBit = 2;
+    static const uint64_t stateBits = readyBit | writingBit;
+    static const size_t locationWords = (sizeof(XrSpaceLocation) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    // The key and result are stored in relaxed atomics and validated against the tag afterwards (a seqlock),
+    // since a slot may be claimed for a later frame while it is being read.
+    struct Slot {
+        std::atomic<uint64_t> tag{0};
+        std::atomic<uint64_t> space{0};
+        std::atomic<uint64_t> baseSpace{0};
+        std::atomic<uint64_t> location[locationWords] = {};
+
+        bool read(uint64_t tag, uint64_t spaceKey, uint64_t baseKey, SpaceLocation& out) const noexcept {
+            if (space.load(std::memory_order_relaxed) != spaceKey || baseSpace.load(std::memory_order_relaxed) != baseKey) {
+                return false;
+            }
+            uint64_t words[locationWords];
+            for (size_t i = 0; i < locationWords; ++i) {
+                words[i] = location[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (this->tag.load(std::memory_order_relaxed) != tag) {
+                return false;
+            }
+            std::memcpy(out.put(), words, sizeof(XrSpaceLocation));
+            return true;
+        }
+
+        // Only called by the caller that claimed the slot, so no other writer races with it.
+        void write(uint64_t generation, uint64_t spaceKey, uint64_t baseKey, SpaceLocation const& in) noexcept {
+            uint64_t words[locationWords] = {};
+            std::memcpy(words, in.get(), sizeof(XrSpaceLocation));
+            std::atomic_thread_fence(std::memory_order_release);
+            space.store(spaceKey, std::memory_order_relaxed);
+            baseSpace.store(baseKey, std::memory_order_relaxed);
+            for (size_t i = 0; i < locationWords; ++i) {
+                location[i].store(words[i], std::memory_order_relaxed);
+            }
+            uint64_t claimed = generation | writingBit;
+            tag.compare_exchange_strong(claimed, generation | readyBit, std::memory_order_release,
+                                        std::memory_order_relaxed);
+        }
+    };
+
+    static uint64_t keyOf(XrSpace handle) noexcept {
+        // XrSpace is a pointer or a 64-bit integer depending on the platform.
+        uint64_t key = 0;
+        std::memcpy(&key, &handle, sizeof(handle));
+        return key;
+    }
+
+    static size_t hash(uint64_t spaceKey, uint64_t baseKey) noexcept {
+        uint64_t h = (spaceKey ^ (baseKey * 0x9e3779b97f4a7c15ull)) * 0xff51afd7ed558ccdull;
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+
+    // Get the generation for the frame at time, starting a new frame if time is later than the current one.
+    // Returns false if time belongs to an earlier frame.
+    bool frameGeneration(Time time, uint64_t& generation) {
+        while (true) {
+            const uint64_t before = frameGeneration_.load(std::memory_order_acquire);
+            const XrTime frameTime = frameTime_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if ((before & stateBits) != 0 || frameGeneration_.load(std::memory_order_relaxed) != before) {
+                continue;  // Frame change in progress.
+            }
+            if (time.get() == frameTime) {
+                generation = before;
+                return true;
+            }
+            if (time.get() < frameTime) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(frameMutex_);
+            if (frameTime_.load(std::memory_order_relaxed) < time.get()) {
+                beginFrame(time.get());
+            }
+        }
+    }
+
+    // Requires frameMutex_. The generation is odd while the time is being changed.
+    void beginFrame(XrTime time) {
+        const uint64_t generation = frameGeneration_.load(std::memory_order_relaxed);
+        frameGeneration_.store(generation + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        frameTime_.store(time, std::memory_order_relaxed);
+        frameGeneration_.store(generation + 4, std::memory_order_release);
+    }
+
+    // Locate into a slot claimed from @p previousTag.
+    template <typename Dispatch>
+    Result fill(Slot& slot, uint64_t previousTag, uint64_t generation, Space space, Space baseSpace, Time time,
+                SpaceLocation& location, Dispatch&& d) {
+        Result result = space.locateSpace(baseSpace, time, location, d);
+        if (failed(result)) {
+            // Hand the slot back as it was, untouched, so that another key can still claim it in this frame.
+            slot.tag.store(previousTag, std::memory_order_release);
+            bypasses_.fetch_add(1, std::memory_order_relaxed);
+            return result;
+        }
+        slot.write(generation, keyOf(space.get()), keyOf(baseSpace.get()), location);
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    template <typename Dispatch>
+    Result passThrough(Space space, Space baseSpace, Time time, SpaceLocation& location, Dispatch&& d) {
+        bypasses_.fetch_add(1, std::memory_order_relaxed);
+        return space.locateSpace(baseSpace, time, location, d);
+    }
+
+    Slot slots_[Capacity];
+    std::atomic<uint64_t> frameGeneration_{4};
+    std::atomic<XrTime> frameTime_{std::numeric_limits<XrTime>::min()};
+    std::mutex frameMutex_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> bypasses_{0};
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
@@ -0,0 +1,235 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains zero-copy views between arrays of projected types and arrays of their raw C types.
+ *
+ * @see xr::Span, xr::as_raw_span, xr::as_projected_span
+ * @ingroup utilities
+ */
+
+#include "openxr_structs.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__has_include) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#if __has_include(<span>)
+#include <span>
+#if defined(__cpp_lib_span)
+#define OPENXR_HPP_HAS_SPAN
+#endif
+#endif
+#endif
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief A non-owning view of a contiguous array, like C++20 `std::span` with a dynamic extent.
+ *
+ * @ingroup utilities
+ */
+template <typename T>
+class Span {
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<T>::type;
+    using size_type = size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    //! Empty span.
+    OPENXR_HPP_CONSTEXPR Span() noexcept : data_(nullptr), size_(0) {}
+
+    //! Span of @p size elements starting at @p data.
+    OPENXR_HPP_CONSTEXPR Span(T* data, size_t size) noexcept : data_(data), size_(size) {}
+
+    //! Conversion from a span of non-const to a span of const elements.
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type>
+    OPENXR_HPP_CONSTEXPR Span(Span<U> const& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    OPENXR_HPP_CONSTEXPR T* data() const noexcept { return data_; }
+    OPENXR_HPP_CONSTEXPR size_t size() const noexcept { return size_; }
+    OPENXR_HPP_CONSTEXPR size_t size_bytes() const noexcept { return size_ * sizeof(T); }
+    OPENXR_HPP_CONSTEXPR bool empty() const noexcept { return size_ == 0; }
+    OPENXR_HPP_CONSTEXPR T* begin() const noexcept { return data_; }
+    OPENXR_HPP_CONSTEXPR T* end() const noexcept { return data_ + size_; }
+    OPENXR_HPP_CONSTEXPR T& operator[](size_t i) const noexcept { return data_[i]; }
+
+#if defined(OPENXR_HPP_HAS_SPAN) || defined(OPENXR_HPP_DOXYGEN)
+    //! Conversion to `std::span`, when available.
+    operator std::span<T>() const noexcept { return {data_, size_}; }
+#endif
+
+private:
+    T* data_;
+    size_t size_;
+};
+
+namespace traits {
+    /*!
+     * @brief Type trait mapping a projected type to the raw C type it is layout-compatible with.
+     *
+     * Specialized for every structure, handle, and atom projection, as well as xr::Time, xr::Duration, xr::Bool32, and xr::Version.
+     *
+     * @ingroup utilities
+     */
+    template <typename T>
+    struct raw_type;
+
+#ifndef OPENXR_HPP_DOXYGEN
+    template <typename T>
+    struct raw_type<T const> {
+        using type = typename raw_type<T>::type const;
+    };
+
+    template <>
+    struct raw_type<EventDataBuffer> {
+        using type = XrEventDataBuffer;
+    };
+    template <>
+    struct raw_type<Time> {
+        using type = XrTime;
+    };
+    template <>
+    struct raw_type<Duration> {
+        using type = XrDuration;
+    };
+    template <>
+    struct raw_type<Bool32> {
+        using type = XrBool32;
+    };
+    template <>
+    struct raw_type<Version> {
+        using type = XrVersion;
+    };
+//# for raw_atom in gen.dict_atoms.keys()
+    template <>
+    struct raw_type</*{ project_type_name(raw_atom) }*/> {
+        using type = /*{ raw_atom }*/;
+    };
+//# endfor
+//# for handle in gen.api_handles if not handle.alias
+    /*{ protect_begin(handle) }*/
+    template <>
+    struct raw_type</*{ project_type_name(handle.name) }*/> {
+        using type = /*{ handle.name }*/;
+    };
+    /*{ protect_end(handle) }*/
+//# endfor
+//# for struct in gen.api_structures if struct.name not in manually_projected and not struct.alias
+    /*{ protect_begin(struct) }*/
+    template <>
+    struct raw_type</*{ project_type_name(struct.name) }*/> {
+        using type = /*{ struct.name }*/;
+    };
+    /*{ protect_end(struct) }*/
+//# endfor
+#endif  // !OPENXR_HPP_DOXYGEN
+}  // namespace traits
+
+namespace impl {
+    //! Checks, at compile time, that arrays of @p Projected may be viewed as arrays of its raw type and back.
+    template <typename Projected>
+    struct LayoutCompatible {
+        using type = typename traits::raw_type<Projected>::type;
+        static_assert(sizeof(Projected) == sizeof(type), "Projected and raw types must have the same size");
+        static_assert(alignof(Projected) == alignof(type), "Projected and raw types must have the same alignment");
+        static_assert(std::is_trivially_copyable<typename std::remove_const<Projected>::type>::value,
+                      "Projected type must be trivially copyable");
+        static_assert(std::is_standard_layout<type>::value, "Raw type must be standard-layout");
+    };
+}  // namespace impl
+
+/*!
+ * @brief View an array of projected values as an array of their raw C type, without copying.
+ *
+ * @ingroup utilities
+ */
+template <typename T>
+OPENXR_HPP_INLINE Span<typename impl::LayoutCompatible<T>::type> as_raw_span(T* data, size_t count) noexcept {
+    return {reinterpret_cast<typename impl::LayoutCompatible<T>::type*>(data), count};
+}
+
+//! @overload
+template <typename T, size_t N>
+OPENXR_HPP_INLINE Span<typename impl::LayoutCompatible<T>::type> as_raw_span(T (&data)[N]) noexcept {
+    return as_raw_span(&data[0], N);
+}
+
+//! @brief View a contiguous container (anything with `data()` and `size()`, like `std::vector`) of projected values as raw values.
+//! @overload
+template <typename Container>
+OPENXR_HPP_INLINE auto as_raw_span(Container& container) noexcept -> decltype(as_raw_span(container.data(), container.size())) {
+    return as_raw_span(container.data(), container.size());
+}
+
+/*!
+ * @brief View an array of raw C values as an array of the projected type @p Projected, without copying.
+ *
+ * The projected type must be given explicitly, since several projections share a raw type (e.g. xr::Path and xr::SystemId).
+ *
+ * @ingroup utilities
+ */
+template <typename Projected>
+OPENXR_HPP_INLINE Span<Projected> as_projected_span(typename impl::LayoutCompatible<Projected>::type* data, size_t count) noexcept {
+    return {reinterpret_cast<Projected*>(data), count};
+}
+
+//! @overload
+template <typename Projected>
+OPENXR_HPP_INLINE Span<Projected const> as_projected_span(typename impl::LayoutCompatible<Projected>::type const* data,
+                                                          size_t count) noexcept {
+    return {reinterpret_cast<Projected const*>(data), count};
+}
+
+//! @overload
+template <typename Projected, typename T, size_t N>
+OPENXR_HPP_INLINE auto as_projected_span(T (&data)[N]) noexcept -> decltype(as_projected_span<Projected>(&data[0], N)) {
+    return as_projected_span<Projected>(&data[0], N);
+}
+
+//! @brief View a contiguous container (anything with `data()` and `size()`) of raw values as projected values.
+//! @overload
+template <typename Projected, typename Container>
+OPENXR_HPP_INLINE auto as_projected_span(Container& container) noexcept
+    -> decltype(as_projected_span<Projected>(container.data(), container.size())) {
+    return as_projected_span<Projected>(container.data(), container.size());
+}
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
@@ -62,6 +62,7 @@
 #define __STDC_WANT_LIB_EXT1__ 1
 #endif
 #include <string.h>
+#include <type_traits>
 
 #include "openxr_enums.hpp"
 #include "openxr_flags.hpp"
@@ -83,7 +84,7 @@ namespace impl {
 
     class XR_MAY_ALIAS InputStructBase {
     protected:
-        InputStructBase(StructureType type_,
+        OPENXR_HPP_CONSTEXPR InputStructBase(StructureType type_,
                         const void* next_ = nullptr)
             : type(type_), next(next_) {}
 
@@ -95,7 +96,7 @@ namespace impl {
 
     class XR_MAY_ALIAS OutputStructBase {
     protected:
-        OutputStructBase(StructureType type_, void* next_ = nullptr)
+        OPENXR_HPP_CONSTEXPR OutputStructBase(StructureType type_, void* next_ = nullptr)
             : type(type_), next(next_) {}
 
     public:
@@ -0,0 +1,251 @@
+//## Copyright (c) 2017-2019 The Khronos Group Inc.
+//## Copyright (c) 2019 Collabora, Ltd.
+//##
+//## Licensed under the Apache License, Version 2.0 (the "License");
+//## you may not use this file except in compliance with the License.
+//## You may obtain a copy of the License at
+//##
+//##     http://www.apache.org/licenses/LICENSE-2.0
+//##
+//## Unless required by applicable law or agreed to in writing, software
+//## distributed under the License is distributed on an "AS IS" BASIS,
+//## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//## See the License for the specific language governing permissions and
+//## limitations under the License.
+//##
+//## ---- Exceptions to the Apache 2.0 License: ----
+//##
+//## As an exception, if you use this Software to generate code and portions of
+//## this Software are embedded into the generated code as a result, you may
+//## redistribute such product without providing attribution as would otherwise
+//## be required by Sections 4(a), 4(b) and 4(d) of the License.
+//##
+//## In addition, if you combine or link code generated by this Software with
+//## software that is licensed under the GPLv2 or the LGPL v2.0 or 2.1
+//## ("`Combined Software`") and if a court of competent jurisdiction determines
+//## that the patent provision (Section 3), the indemnity provision (Section 9)
+//## or other Section of the License conflicts with the conditions of the
+//## applicable GPL or LGPL license, you may retroactively and prospectively
+//## choose to deem waived or otherwise exclude such Section(s) of the License,
+//## but only in their entirety and only with respect to the Combined Software.
+
+
+
+//# include('file_header.hpp')
+/**
+ * @file
+ * @brief Contains a swapchain image manager that enumerates images once and acquires each next image early.
+ *
+ * @see xr::SwapchainRing
+ * @ingroup utilities
+ */
+
+#include "openxr_handles.hpp"
+#include "openxr_structs.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+//# include('define_assert.hpp') without context
+
+//# include('define_namespace.hpp') without context
+
+namespace OPENXR_HPP_NAMESPACE {
+
+/*!
+ * @brief Latency statistics gathered by a SwapchainRing.
+ *
+ * @ingroup utilities
+ */
+struct SwapchainRingStats {
+    //! Number of images acquired.
+    uint64_t acquireCount = 0;
+    //! Number of images that were already ready, thanks to prefetching, when acquireImage() asked for them.
+    uint64_t prefetchHitCount = 0;
+    //! Total time spent in `xrAcquireSwapchainImage`.
+    Duration acquireTime{0};
+    //! Longest single `xrAcquireSwapchainImage` call.
+    Duration maxAcquireTime{0};
+    //! Total time spent in `xrWaitSwapchainImage`.
+    Duration waitTime{0};
+    //! Longest total wait for a single image.
+    Duration maxWaitTime{0};
+};
+
+/*!
+ * @brief Manages the images of one swapchain: enumerates them once, then acquires, waits and releases each frame.
+ *
+ * The images are enumerated by init() into fixed storage, so nothing is allocated per frame. The ring tracks
+ * the image in flight through its acquire → wait → release cycle. Once an image is released, the ring immediately
+ * acquires the next one and polls its wait without blocking. That work then overlaps with whatever the CPU does
+ * until the next acquireImage(), which often finds the image already available.
+ *
+ * Disable prefetching with setPrefetch() for static swapchains, which only ever have one image acquired.
+ *
+ * @tparam ImageT A projected swapchain image structure, such as SwapchainImageOpenGLKHR, whose default constructor
+ * sets its type.
+ * @tparam MaxImages Maximum number of images in the swapchain.
+ *
+ * @ingroup utilities
+ */
+template <typename ImageT, uint32_t MaxImages = 8>
+class SwapchainRing {
+   public:
+    SwapchainRing() = default;
+
+    //! Enumerate the images of @p swapchain. Must be called before anything else; may be called again for another swapchain.
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result init(Swapchain swapchain, Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) noexcept {
+        swapchain_ = swapchain;
+        state_ = State::Idle;
+        imageCount_ = 0;
+        for (ImageT& image : images_) {
+            image = ImageT{};
+        }
+        return static_cast<Result>(d.xrEnumerateSwapchainImages(swapchain_.get(), MaxImages, &imageCount_,
+                                                                reinterpret_cast<XrSwapchainImageBaseHeader*>(images_)));
+    }
+
+    /*!
+     * @brief Make the next image available for rendering, waiting up to @p timeout for it.
+     *
+     * If an image is already available, returns immediately. Returns Result::TimeoutExpired if the image was acquired
+     * but is not ready yet; call again to keep waiting. On success, the image is currentImage().
+     */
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result acquireImage(Duration timeout = Duration::infinite(), Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) noexcept {
+        if (state_ == State::Ready) {
+            ++stats_.prefetchHitCount;
+            state_ = State::InUse;
+            return Result::Success;
+        }
+        OPENXR_HPP_ASSERT(state_ != State::InUse);
+        if (state_ == State::Idle) {
+            const Result result = acquire(d);
+            if (failed(result)) {
+                return result;
+            }
+        }
+        const Result result = wait(timeout, d);
+        if (result == Result::Success) {
+            state_ = State::InUse;
+        }
+        return result;
+    }
+
+    //! Release the image returned by acquireImage(), then prefetch the next one unless prefetching is disabled.
+    template <typename Dispatch OPENXR_HPP_DEFAULT_CORE_DISPATCH_TYPE_ARG, OPENXR_HPP_REQUIRE_DISPATCH(Dispatch) = 0>
+    Result releaseImage(Dispatch&& d OPENXR_HPP_DEFAULT_CORE_DISPATCH_ARG) noexcept {
+        OPENXR_HPP_ASSERT(state_ == State::InUse);
+        XrSwapchainImageReleaseInfo releaseInfo{};
+        releaseInfo.type = XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO;
+        const Result result = static_cast<Result>(d.xrReleaseSwapchainImage(swapchain_.get(), &releaseInfo));
+        if (failed(result)) {
+            return result;
+        }
+        state_ = State::Idle;
+        if (prefetch_ && succeeded(acquire(d))) {
+            // Failures here are reported again by the next acquireImage().
+            wait(Duration{XR_NO_DURATION}, d);
+        }
+        return result;
+    }
+
+    //! Enable or disable acquiring the next image as soon as the current one is released. Enabled by default.
+    void setPrefetch(bool prefetch) noexcept { prefetch_ = prefetch; }
+
+    //! The swapchain passed to init().
+    Swapchain swapchain() const noexcept { return swapchain_; }
+
+    //! Number of images in the swapchain.
+    uint32_t imageCount() const noexcept { return imageCount_; }
+
+    //! The image at @p index.
+    ImageT const& image(uint32_t index) const noexcept {
+        OPENXR_HPP_ASSERT(index < imageCount_);
+        return images_[index];
+    }
+
+    //! Index of the image in flight: the one returned by acquireImage(), or being prefetched.
+    uint32_t currentIndex() const noexcept {
+        OPENXR_HPP_ASSERT(state_ != State::Idle);
+        return index_;
+    }
+
+    //! The image returned by acquireImage(), until releaseImage().
+    ImageT const& currentImage() const noexcept {
+        OPENXR_HPP_ASSERT(state_ == State::InUse);
+        return images_[index_];
+    }
+
+    //! True between a successful acquireImage() and the following releaseImage().
+    bool hasImage() const noexcept { return state_ == State::InUse; }
+
+    //! Acquire and wait latencies since init() or resetStats().
+    SwapchainRingStats const& stats() const noexcept { return stats_; }
+
+    //! Clear the statistics.
+    void resetStats() noexcept { stats_ = SwapchainRingStats{}; }
+
+   private:
+    // Idle: nothing acquired. Acquired: acquired, not yet waited. Ready: waited, not yet handed out. InUse: handed out.
+    enum class State : uint8_t { Idle, Acquired, Ready, InUse };
+
+    using Clock = std::chrono::steady_clock;
+
+    static Duration elapsedSince(Clock::time_point start) noexcept {
+        return Duration{std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()};
+    }
+
+    template <typename Dispatch>
+    Result acquire(Dispatch&& d) noexcept {
+        XrSwapchainImageAcquireInfo acquireInfo{};
+        acquireInfo.type = XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO;
+        const Clock::time_point start = Clock::now();
+        const Result result = static_cast<Result>(d.xrAcquireSwapchainImage(swapchain_.get(), &acquireInfo, &index_));
+        const Duration elapsed = elapsedSince(start);
+        stats_.acquireTime += elapsed;
+        if (elapsed > stats_.maxAcquireTime) {
+            stats_.maxAcquireTime = elapsed;
+        }
+        if (succeeded(result)) {
+            OPENXR_HPP_ASSERT(index_ < imageCount_);
+            ++stats_.acquireCount;
+            state_ = State::Acquired;
+            imageWaitTime_ = Duration{0};
+        }
+        return result;
+    }
+
+    template <typename Dispatch>
+    Result wait(Duration timeout, Dispatch&& d) noexcept {
+        XrSwapchainImageWaitInfo waitInfo{};
+        waitInfo.type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
+        waitInfo.timeout = timeout.get();
+        const Clock::time_point start = Clock::now();
+        const Result result = static_cast<Result>(d.xrWaitSwapchainImage(swapchain_.get(), &waitInfo));
+        const Duration elapsed = elapsedSince(start);
+        stats_.waitTime += elapsed;
+        imageWaitTime_ += elapsed;
+        if (result == Result::Success) {
+            state_ = State::Ready;
+            if (imageWaitTime_ > stats_.maxWaitTime) {
+                stats_.maxWaitTime = imageWaitTime_;
+            }
+        }
+        return result;
+    }
+
+    ImageT images_[MaxImages];
+    Swapchain swapchain_;
+    uint32_t imageCount_ = 0;
+    uint32_t index_ = 0;
+    State state_ = State::Idle;
+    bool prefetch_ = true;
+    Duration imageWaitTime_{0};
+    SwapchainRingStats stats_;
+};
+
+}  // namespace OPENXR_HPP_NAMESPACE
+
+//# include('file_footer.hpp')
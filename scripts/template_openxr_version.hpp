@@ -152,11 +152,20 @@ static OPENXR_HPP_CONSTEXPR Version current() noexcept
 //# endfilter
 static inline std::string to_string(Version const& v)
 {
-    auto ret = std::to_string(v.major());
-    ret += ".";
-    ret += std::to_string(v.minor());
-    ret += ".";
-    ret += std::to_string(v.patch());
-    return ret;
+    // Written backwards into a buffer on the stack, so that the result is the only allocation.
+    char text[32];
+    char* const last = text + sizeof(text);
+    char* first = last;
+    const uint32_t parts[] = {v.patch(), v.minor(), v.major()};
+    for (uint32_t part : parts) {
+        if (first != last) {
+            *--first = '.';
+        }
+        do {
+            *--first = static_cast<char>('0' + part % 10);
+            part /= 10;
+        } while (part != 0);
+    }
+    return std::string(first, last);
 }
 //# endblock extra_free_functions
@@ -0,0 +1,112 @@
+#include "openxr/openxr_action_manifest.hpp"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr const char *kHands[] = {"/user/hand/left", "/user/hand/right"};
+constexpr xr::ManifestAction kActions[] = {
+    {"grab", "Grab", xr::ActionType::BooleanInput, 0x3},
+    {"hand-pose", "Hand Pose", xr::ActionType::PoseInput, 0x3},
+    {"menu", "Menu", xr::ActionType::BooleanInput, 0x0},
+};
+constexpr xr::ManifestBinding kBindings[] = {
+    {"/interaction_profiles/khr/simple_controller", 0, "/user/hand/left/input/select/click"},
+    {"/interaction_profiles/khr/simple_controller", 0, "/user/hand/right/input/select/click"},
+    {"/interaction_profiles/khr/simple_controller", 1, "/user/hand/left/input/grip/pose"},
+    {"/interaction_profiles/valve/index_controller", 1, "/user/hand/left/input/grip/pose"},
+    {"/interaction_profiles/khr/simple_controller", 2, "/user/hand/left/input/menu/click"},
+};
+constexpr xr::ActionManifest kManifest{"gameplay", "Gameplay", 0, kActions, kHands, kBindings};
+static_assert(kManifest.isValid(), "manifest should be valid");
+static_assert(kManifest.actionIndex("hand-pose") == 1, "lookup by name at compile time");
+static_assert(kManifest.actionIndex("missing") == kManifest.actionCount(), "missing names map past the end");
+
+constexpr xr::ManifestAction kBadName[] = {{"Grab", "Grab", xr::ActionType::BooleanInput, 0}};
+constexpr xr::ManifestAction kDuplicate[] = {{"grab", "Grab", xr::ActionType::BooleanInput, 0},
+                                             {"grab", "Grab 2", xr::ActionType::BooleanInput, 0}};
+constexpr xr::ManifestAction kBadMask[] = {{"grab", "Grab", xr::ActionType::BooleanInput, 0x4}};
+constexpr xr::ManifestBinding kBadAction[] = {{"/interaction_profiles/khr/simple_controller", 5, "/user/hand/left/input/select/click"}};
+static_assert(!xr::ActionManifest("gameplay", "Gameplay", 0, kBadName, kBindings).isValid(), "uppercase names are invalid");
+static_assert(!xr::ActionManifest("gameplay", "Gameplay", 0, kDuplicate, kBindings).isValid(), "names must be unique");
+static_assert(!xr::ActionManifest("gameplay", "Gameplay", 0, kBadMask, kHands, kBindings).isValid(), "mask out of range");
+static_assert(!xr::ActionManifest("gameplay", "Gameplay", 0, kActions, kHands, kBadAction).isValid(), "action out of range");
+static_assert(!xr::ActionManifest("", "Gameplay", 0, kActions, kHands, kBindings).isValid(), "empty set name");
+
+struct ManifestDispatch {
+  std::map<std::string, XrPath> paths;
+  std::vector<XrActionCreateInfo> actions;
+  std::vector<std::vector<XrActionSuggestedBinding>> suggestions;
+  uintptr_t nextHandle = 1;
+  bool failSuggest = false;
+  uint32_t destroyed = 0;
+
+  XrResult xrStringToPath(XrInstance, const char *pathString, XrPath *path) {
+    if (paths.count(pathString) != 0) {
+      return XR_ERROR_RUNTIME_FAILURE; // should only be asked once per string
+    }
+    *path = paths.size() + 1;
+    paths[pathString] = *path;
+    return XR_SUCCESS;
+  }
+  XrResult xrCreateActionSet(XrInstance, const XrActionSetCreateInfo *info, XrActionSet *actionSet) {
+    EXPECT_STREQ(info->actionSetName, "gameplay");
+    *actionSet = reinterpret_cast<XrActionSet>(nextHandle++);
+    return XR_SUCCESS;
+  }
+  XrResult xrCreateAction(XrActionSet, const XrActionCreateInfo *info, XrAction *action) {
+    actions.push_back(*info);
+    *action = reinterpret_cast<XrAction>(nextHandle++);
+    return XR_SUCCESS;
+  }
+  XrResult xrSuggestInteractionProfileBindings(XrInstance, const XrInteractionProfileSuggestedBinding *bindings) {
+    suggestions.emplace_back(bindings->suggestedBindings,
+                             bindings->suggestedBindings + bindings->countSuggestedBindings);
+    return failSuggest ? XR_ERROR_PATH_UNSUPPORTED : XR_SUCCESS;
+  }
+  XrResult xrDestroyActionSet(XrActionSet) {
+    ++destroyed;
+    return XR_SUCCESS;
+  }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(ManifestDispatch)
+
+class OpenXrActionManifestTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrActionManifestTest, createTest) {
+  ManifestDispatch d;
+  xr::ActionManifestHandles handles;
+  EXPECT_TRUE(xr::createActionManifest(xr::Instance{}, kManifest, handles, d) == xr::Result::Success);
+
+  // 2 hands + 4 distinct binding paths + 2 profiles, each converted once.
+  EXPECT_EQ(d.paths.size(), 8u);
+  ASSERT_EQ(d.actions.size(), 3u);
+  EXPECT_STREQ(d.actions[1].actionName, "hand-pose");
+  EXPECT_EQ(d.actions[1].countSubactionPaths, 2u);
+  EXPECT_EQ(d.actions[2].countSubactionPaths, 0u);
+  ASSERT_EQ(d.suggestions.size(), 2u);
+  EXPECT_EQ(d.suggestions[0].size(), 4u);
+  EXPECT_EQ(d.suggestions[1].size(), 1u);
+
+  ASSERT_EQ(handles.actions.size(), 3u);
+  EXPECT_TRUE(handles.actions[kManifest.actionIndex("menu")].get() == reinterpret_cast<XrAction>(4));
+  EXPECT_TRUE(d.suggestions[1][0].action == handles.actions[1].get());
+  EXPECT_EQ(handles.subactionPaths.size(), 2u);
+  EXPECT_EQ(d.destroyed, 0u);
+
+  ManifestDispatch failing;
+  failing.failSuggest = true;
+  EXPECT_TRUE(xr::createActionManifest(xr::Instance{}, kManifest, handles, failing) == xr::Result::ErrorPathUnsupported);
+  EXPECT_EQ(failing.destroyed, 1u);
+  EXPECT_TRUE(handles.actions.empty());
+}
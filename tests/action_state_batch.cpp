@@ -0,0 +1,94 @@
+#include "openxr/openxr_action_state_batch.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+// Action handle values double as the state to report; odd actions report a change.
+struct ActionStateDispatch {
+  uint32_t calls = 0;
+
+  static uintptr_t value(const XrActionStateGetInfo *info) {
+    return reinterpret_cast<uintptr_t>(info->action) + uintptr_t(info->subactionPath);
+  }
+
+  XrResult xrGetActionStateBoolean(XrSession, const XrActionStateGetInfo *info, XrActionStateBoolean *state) {
+    ++calls;
+    state->currentState = value(info) % 2;
+    state->changedSinceLastSync = value(info) % 2;
+    state->isActive = XR_TRUE;
+    return XR_SUCCESS;
+  }
+
+  XrResult xrGetActionStateFloat(XrSession, const XrActionStateGetInfo *info, XrActionStateFloat *state) {
+    ++calls;
+    if (value(info) == 0) {
+      return XR_ERROR_ACTION_TYPE_MISMATCH;
+    }
+    state->currentState = float(value(info)) / 10.f;
+    state->isActive = XR_TRUE;
+    return XR_SUCCESS;
+  }
+
+  XrResult xrGetActionStateVector2f(XrSession, const XrActionStateGetInfo *info, XrActionStateVector2f *state) {
+    ++calls;
+    state->currentState = XrVector2f{float(value(info)), -float(value(info))};
+    state->changedSinceLastSync = XR_TRUE;
+    state->isActive = XR_TRUE;
+    return XR_SUCCESS;
+  }
+
+  XrResult xrGetActionStatePose(XrSession, const XrActionStateGetInfo *info, XrActionStatePose *state) {
+    ++calls;
+    state->isActive = value(info) > 1;
+    return XR_SUCCESS;
+  }
+};
+
+xr::Action makeAction(uintptr_t value) { return xr::Action{reinterpret_cast<XrAction>(value)}; }
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(ActionStateDispatch)
+
+class OpenXrActionStateBatchTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrActionStateBatchTest, updateTest) {
+  ActionStateDispatch d;
+  xr::ActionStateBatch batch;
+  // Enough boolean actions to span two words of bits.
+  for (uintptr_t i = 0; i < 70; ++i) {
+    EXPECT_EQ(batch.addBoolean(makeAction(i)), i);
+  }
+  EXPECT_EQ(batch.addFloat(makeAction(5)), 0u);
+  EXPECT_EQ(batch.addFloat(makeAction(0)), 1u);
+  EXPECT_EQ(batch.addVector2f(makeAction(3), xr::Path{4}), 0u);
+  EXPECT_EQ(batch.addPose(makeAction(1)), 0u);
+  EXPECT_EQ(batch.addPose(makeAction(2)), 1u);
+
+  EXPECT_TRUE(batch.update(xr::Session{}, d) == xr::Result::ErrorActionTypeMismatch);
+  EXPECT_EQ(d.calls, 75u);
+
+  EXPECT_EQ(batch.booleans().currentState.size(), 70u);
+  EXPECT_FALSE(batch.booleans().currentState[0]);
+  EXPECT_TRUE(batch.booleans().currentState[1]);
+  EXPECT_TRUE(batch.booleans().currentState[69]);
+  EXPECT_TRUE(batch.booleans().changedSinceLastSync[67]);
+  EXPECT_TRUE(batch.booleans().isActive[68]);
+  EXPECT_EQ(batch.booleans().currentState.words()[0], 0xaaaaaaaaaaaaaaaaull);
+
+  EXPECT_FLOAT_EQ(batch.floats().currentState[0], 0.5f);
+  EXPECT_TRUE(batch.floats().isActive[0]);
+  EXPECT_FALSE(batch.floats().isActive[1]);
+  EXPECT_FALSE(batch.floats().changedSinceLastSync.any());
+
+  EXPECT_EQ(batch.vector2fs().x[0], 7.f);
+  EXPECT_EQ(batch.vector2fs().y[0], -7.f);
+  EXPECT_TRUE(batch.vector2fs().changedSinceLastSync.any());
+
+  EXPECT_FALSE(batch.poses().isActive[0]);
+  EXPECT_TRUE(batch.poses().isActive[1]);
+}
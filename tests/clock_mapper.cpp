@@ -0,0 +1,132 @@
+#define XR_USE_TIMESPEC
+#include <time.h>
+
+#include "openxr/openxr_platform.h"
+#include "openxr/openxr_clock_mapper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace {
+// A clock the tests move by hand.
+struct FakeClock {
+  using duration = std::chrono::nanoseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<FakeClock>;
+  static constexpr bool is_steady = true;
+
+  static int64_t current;
+  static time_point now() { return time_point{duration{current}}; }
+};
+int64_t FakeClock::current = 0;
+
+// The runtime clock starts 5 s ahead and runs 100 ppm fast.
+constexpr double kDrift = 100e-6;
+XrTime runtimeTime(int64_t clockNs) { return 5000000000 + clockNs + static_cast<int64_t>(double(clockNs) * kDrift); }
+
+struct TimespecDispatch {
+  int calls = 0;
+
+  XrResult xrConvertTimespecTimeToTimeKHR(XrInstance, const struct timespec *timespecTime, XrTime *time) {
+    ++calls;
+    *time = runtimeTime(int64_t(timespecTime->tv_sec) * 1000000000 + timespecTime->tv_nsec);
+    return XR_SUCCESS;
+  }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(TimespecDispatch)
+
+class OpenXrClockMapperTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrClockMapperTest, durationChronoTest) {
+  xr::Duration duration{std::chrono::milliseconds(5)};
+  EXPECT_EQ(duration.get(), 5000000);
+  EXPECT_EQ(duration.toChrono(), std::chrono::microseconds(5000));
+  EXPECT_EQ(xr::Duration{std::chrono::duration<double>(0.25)}.get(), 250000000);
+}
+
+TEST_F(OpenXrClockMapperTest, modelTest) {
+  using TimePoint = FakeClock::time_point;
+  xr::ClockMapper<FakeClock> mapper;
+  EXPECT_FALSE(mapper.calibrated());
+  EXPECT_FALSE(mapper.toTime(TimePoint{}));
+
+  for (int64_t second = 1; second <= 3; ++second) {
+    const int64_t clockNs = second * 1000000000;
+    mapper.addSample(TimePoint{std::chrono::nanoseconds{clockNs}}, xr::Time{runtimeTime(clockNs)});
+  }
+  EXPECT_TRUE(mapper.calibrated());
+  EXPECT_NEAR(mapper.drift(), kDrift, 1e-9);
+
+  // Between and well beyond the samples, the model agrees with the runtime to within a nanosecond.
+  for (int64_t clockNs : {int64_t(2500000000), int64_t(3000000001), int64_t(4700000000), int64_t(60000000000)}) {
+    const TimePoint clockTime{std::chrono::nanoseconds{clockNs}};
+    const xr::Time xrTime = mapper.toTime(clockTime);
+    EXPECT_NEAR(double(xrTime.get()), double(runtimeTime(clockNs)), 1.0);
+    EXPECT_NEAR(double(mapper.toTimePoint(xrTime).time_since_epoch().count()), double(clockNs), 1.0);
+  }
+}
+
+TEST_F(OpenXrClockMapperTest, outlierTest) {
+  using TimePoint = FakeClock::time_point;
+  xr::ClockMapper<FakeClock> mapper;
+  mapper.addSample(TimePoint{std::chrono::seconds(1)}, xr::Time{runtimeTime(1000000000)});
+  mapper.addSample(TimePoint{std::chrono::seconds(2)}, xr::Time{runtimeTime(2000000000)});
+  // A sample 10 ms off after a second moves neither the drift estimate nor the anchor.
+  mapper.addSample(TimePoint{std::chrono::seconds(3)}, xr::Time{runtimeTime(3000000000) + 10000000});
+  EXPECT_NEAR(mapper.drift(), kDrift, 1e-9);
+  EXPECT_NEAR(double(mapper.toTime(TimePoint{std::chrono::seconds(3)}).get()), double(runtimeTime(3000000000)), 1.0);
+  // The next good sample is measured against the last good one.
+  mapper.addSample(TimePoint{std::chrono::seconds(4)}, xr::Time{runtimeTime(4000000000)});
+  EXPECT_NEAR(mapper.drift(), kDrift, 1e-9);
+  EXPECT_EQ(mapper.toTime(TimePoint{std::chrono::seconds(4)}).get(), runtimeTime(4000000000));
+}
+
+TEST_F(OpenXrClockMapperTest, sampleTest) {
+  TimespecDispatch d;
+  xr::ClockMapper<FakeClock> mapper{xr::Duration{std::chrono::milliseconds(500)}};
+  FakeClock::current = 1000000000;
+  EXPECT_TRUE(mapper.sampleDue());
+  EXPECT_TRUE(mapper.sampleIfDue(xr::Instance{}, d) == xr::Result::Success);
+  EXPECT_EQ(d.calls, 1);
+  EXPECT_EQ(mapper.now().get(), runtimeTime(1000000000));
+
+  // Conversions and frequent sampleIfDue() calls don't reach the runtime.
+  for (int i = 0; i < 100; ++i) {
+    FakeClock::current += 1000000;
+    mapper.sampleIfDue(xr::Instance{}, d);
+    EXPECT_NEAR(double(mapper.now().get()), double(runtimeTime(FakeClock::current)), 20000.0);
+  }
+  EXPECT_EQ(d.calls, 1);
+  FakeClock::current += 400000000;
+  mapper.sampleIfDue(xr::Instance{}, d);
+  EXPECT_EQ(d.calls, 2);
+  EXPECT_NEAR(mapper.drift(), kDrift, 1e-9);
+}
+
+TEST_F(OpenXrClockMapperTest, concurrentTest) {
+  using TimePoint = FakeClock::time_point;
+  xr::ClockMapper<FakeClock> mapper;
+  mapper.addSample(TimePoint{std::chrono::seconds(1)}, xr::Time{runtimeTime(1000000000)});
+  std::thread writer([&] {
+    for (int64_t i = 2; i < 2000; ++i) {
+      const int64_t clockNs = i * 1000000000;
+      mapper.addSample(TimePoint{std::chrono::nanoseconds{clockNs}}, xr::Time{runtimeTime(clockNs)});
+    }
+  });
+  // Readers never see a half-updated model.
+  for (int i = 0; i < 20000; ++i) {
+    const int64_t clockNs = 500000000 + int64_t(i) * 100000000;
+    EXPECT_NEAR(double(mapper.toTime(TimePoint{std::chrono::nanoseconds{clockNs}}).get()), double(runtimeTime(clockNs)),
+                double(clockNs) * 2 * kDrift + 1);
+  }
+  writer.join();
+}
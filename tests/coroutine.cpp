@@ -0,0 +1,242 @@
+#include "openxr/openxr_coroutine.hpp"
+
+#include <gtest/gtest.h>
+
+#ifdef OPENXR_HPP_HAS_COROUTINES
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <stdexcept>
+
+namespace {
+// A runtime whose swapchain images become ready after a number of polls, with a queue of pending events.
+struct AsyncDispatch {
+  std::map<XrSwapchain, int> pollsUntilReady;
+  std::map<XrSwapchain, int> polls;
+  std::deque<XrStructureType> events;
+  int sceneUpdates = 0;
+
+  XrResult xrWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo *waitInfo) {
+    EXPECT_EQ(waitInfo->timeout, XR_NO_DURATION);
+    int &count = polls[swapchain];
+    ++count;
+    auto ready = pollsUntilReady.find(swapchain);
+    return ready != pollsUntilReady.end() && count >= ready->second ? XR_SUCCESS : XR_TIMEOUT_EXPIRED;
+  }
+
+  XrResult xrPollEvent(XrInstance, XrEventDataBuffer *eventData) {
+    if (events.empty()) {
+      return XR_EVENT_UNAVAILABLE;
+    }
+    eventData->type = events.front();
+    events.pop_front();
+    return XR_SUCCESS;
+  }
+
+  XrResult xrGetSceneComputeStateMSFT(XrSceneObserverMSFT, XrSceneComputeStateMSFT *state) {
+    *state = sceneUpdates-- > 0 ? XR_SCENE_COMPUTE_STATE_UPDATING_MSFT : XR_SCENE_COMPUTE_STATE_COMPLETED_MSFT;
+    return XR_SUCCESS;
+  }
+};
+
+// Forwards to a shared AsyncDispatch, since awaitables copy their dispatch.
+struct AsyncDispatchRef {
+  AsyncDispatch *runtime;
+
+  XrResult xrWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo *waitInfo) const {
+    return runtime->xrWaitSwapchainImage(swapchain, waitInfo);
+  }
+  XrResult xrPollEvent(XrInstance instance, XrEventDataBuffer *eventData) const {
+    return runtime->xrPollEvent(instance, eventData);
+  }
+  XrResult xrGetSceneComputeStateMSFT(XrSceneObserverMSFT sceneObserver, XrSceneComputeStateMSFT *state) const {
+    return runtime->xrGetSceneComputeStateMSFT(sceneObserver, state);
+  }
+};
+
+struct FrameDispatch {
+  int *waits;
+  int maxWaits;
+
+  XrResult xrWaitFrame(XrSession, const XrFrameWaitInfo *, XrFrameState *state) const {
+    if (*waits == maxWaits) {
+      return XR_ERROR_SESSION_NOT_RUNNING;
+    }
+    state->predictedDisplayTime = ++*waits;
+    return XR_SUCCESS;
+  }
+  XrResult xrBeginFrame(XrSession, const XrFrameBeginInfo *) const { return XR_SUCCESS; }
+  XrResult xrEndFrame(XrSession, const XrFrameEndInfo *) const { return XR_SUCCESS; }
+};
+
+xr::Swapchain makeSwapchain(uintptr_t value) { return xr::Swapchain{reinterpret_cast<XrSwapchain>(value)}; }
+
+xr::coro::Task<int> answer(xr::coro::Executor &executor) {
+  co_await xr::coro::sleepFor(executor, std::chrono::milliseconds(1));
+  co_return 42;
+}
+
+xr::coro::Task<int> fail(xr::coro::Executor &executor) {
+  co_await xr::coro::sleepFor(executor, std::chrono::milliseconds(0));
+  throw std::runtime_error("failed");
+}
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(AsyncDispatchRef)
+OPENXR_HPP_CLASS_IS_DISPATCH(FrameDispatch)
+
+class OpenXrCoroutineTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrCoroutineTest, taskTest) {
+  xr::coro::Executor executor;
+  int result = 0;
+  bool caught = false;
+  // Named, since a coroutine lambda's captures live in the lambda object rather than the coroutine frame.
+  auto run = [&]() -> xr::coro::Task<> {
+    result = co_await answer(executor);
+    try {
+      co_await fail(executor);
+    } catch (std::runtime_error const &) {
+      caught = true;
+    }
+  };
+  executor.spawn(run());
+  EXPECT_EQ(result, 0);
+  executor.run();
+  EXPECT_EQ(result, 42);
+  EXPECT_TRUE(caught);
+  EXPECT_TRUE(executor.idle());
+}
+
+TEST_F(OpenXrCoroutineTest, swapchainTest) {
+  AsyncDispatch runtime;
+  xr::Swapchain color = makeSwapchain(1);
+  xr::Swapchain depth = makeSwapchain(2);
+  runtime.pollsUntilReady[color.get()] = 3;
+  runtime.pollsUntilReady[depth.get()] = 5;
+
+  // One thread waits on both swapchains at once.
+  xr::coro::Executor executor(std::chrono::microseconds(10));
+  xr::Result colorResult = xr::Result::ErrorRuntimeFailure;
+  xr::Result depthResult = xr::Result::ErrorRuntimeFailure;
+  auto wait = [&](xr::Swapchain swapchain, xr::Result &result) -> xr::coro::Task<> {
+    result = co_await xr::coro::waitSwapchainImage(executor, swapchain, xr::Duration::infinite(), AsyncDispatchRef{&runtime});
+  };
+  executor.spawn(wait(color, colorResult));
+  executor.spawn(wait(depth, depthResult));
+  executor.runOnce();
+  EXPECT_EQ(executor.parkedCount(), 2u);
+  executor.run();
+  EXPECT_TRUE(colorResult == xr::Result::Success);
+  EXPECT_TRUE(depthResult == xr::Result::Success);
+  EXPECT_EQ(runtime.polls[color.get()], 3);
+  EXPECT_EQ(runtime.polls[depth.get()], 5);
+}
+
+TEST_F(OpenXrCoroutineTest, swapchainTimeoutTest) {
+  AsyncDispatch runtime;
+  xr::coro::Executor executor(std::chrono::microseconds(100));
+  xr::Result result = xr::Result::Success;
+  auto waitForImage = [&]() -> xr::coro::Task<> {
+    result = co_await xr::coro::waitSwapchainImage(executor, makeSwapchain(1), xr::Duration{2000000},
+                                                   AsyncDispatchRef{&runtime});
+  };
+  executor.spawn(waitForImage());
+  executor.run();
+  EXPECT_TRUE(result == xr::Result::TimeoutExpired);
+  EXPECT_GT(runtime.polls[makeSwapchain(1).get()], 1);
+}
+
+TEST_F(OpenXrCoroutineTest, eventTest) {
+  AsyncDispatch runtime;
+  xr::coro::Executor executor(std::chrono::microseconds(10));
+  std::vector<xr::StructureType> received;
+  auto receive = [&]() -> xr::coro::Task<> {
+    xr::EventDataBuffer event;
+    for (int i = 0; i < 2; ++i) {
+      xr::Result result = co_await xr::coro::nextEvent(executor, xr::Instance{}, event, AsyncDispatchRef{&runtime});
+      EXPECT_TRUE(result == xr::Result::Success);
+      received.push_back(event.type);
+    }
+  };
+  executor.spawn(receive());
+  auto send = [&]() -> xr::coro::Task<> {
+    co_await xr::coro::sleepFor(executor, std::chrono::milliseconds(2));
+    runtime.events.push_back(XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED);
+    co_await xr::coro::pollUntil(executor, [&] { return runtime.events.empty(); });
+    runtime.events.push_back(XR_TYPE_EVENT_DATA_EVENTS_LOST);
+  };
+  executor.spawn(send());
+  executor.run();
+  ASSERT_EQ(received.size(), 2u);
+  EXPECT_TRUE(received[0] == xr::StructureType::EventDataSessionStateChanged);
+  EXPECT_TRUE(received[1] == xr::StructureType::EventDataEventsLost);
+}
+
+TEST_F(OpenXrCoroutineTest, throwingConditionTest) {
+  xr::coro::Executor executor(std::chrono::microseconds(10));
+  int polls = 0;
+  bool caught = false;
+  auto run = [&]() -> xr::coro::Task<> {
+    try {
+      co_await xr::coro::pollUntil(executor, [&]() -> bool {
+        if (++polls == 3) {
+          throw std::runtime_error("condition failed");
+        }
+        return false;
+      });
+    } catch (std::runtime_error const &) {
+      caught = true;
+    }
+  };
+  executor.spawn(run());
+  executor.run();
+  EXPECT_EQ(polls, 3);
+  EXPECT_TRUE(caught);
+  EXPECT_TRUE(executor.idle());
+}
+
+TEST_F(OpenXrCoroutineTest, sceneComputeTest) {
+  AsyncDispatch runtime;
+  runtime.sceneUpdates = 3;
+  xr::coro::Executor executor(std::chrono::microseconds(10));
+  xr::Result result = xr::Result::ErrorRuntimeFailure;
+  xr::SceneComputeStateMSFT state = xr::SceneComputeStateMSFT::None;
+  auto compute = [&]() -> xr::coro::Task<> {
+    result = co_await xr::coro::sceneComputed(executor, xr::SceneObserverMSFT{}, state, AsyncDispatchRef{&runtime});
+  };
+  executor.spawn(compute());
+  executor.run();
+  EXPECT_TRUE(result == xr::Result::Success);
+  EXPECT_TRUE(state == xr::SceneComputeStateMSFT::Completed);
+  EXPECT_EQ(runtime.sceneUpdates, -1);
+}
+
+TEST_F(OpenXrCoroutineTest, frameTest) {
+  int waits = 0;
+  xr::FramePipeline<FrameDispatch> pipeline(xr::Session{}, FrameDispatch{&waits, 3});
+  xr::coro::Executor executor(std::chrono::microseconds(10));
+  std::vector<int64_t> times;
+  auto renderFrames = [&]() -> xr::coro::Task<> {
+    xr::PipelinedFrame frame;
+    while (co_await xr::coro::nextFrame(executor, pipeline, frame)) {
+      times.push_back(frame.state.predictedDisplayTime.get());
+      pipeline.beginFrame(frame);
+      pipeline.endFrame(frame, xr::FrameEndInfo{});
+    }
+  };
+  executor.spawn(renderFrames());
+  pipeline.start();
+  executor.run();
+  pipeline.stop();
+  EXPECT_EQ(times, (std::vector<int64_t>{1, 2, 3}));
+  EXPECT_TRUE(pipeline.waitResult() == xr::Result::ErrorSessionNotRunning);
+}
+
+#endif // OPENXR_HPP_HAS_COROUTINES
@@ -0,0 +1,144 @@
+#include <openxr/openxr.h>
+
+// Leaves out a guarded enum value, to check that reflection only lists the values that are compiled in.
+#undef XR_VARJO_quad_views
+
+#include "openxr/openxr_enum_parse.hpp"
+#include "openxr/openxr_enums.hpp"
+#include "openxr/openxr_flags.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+
+// Looked up in a perfect hash table, and still usable in constant expressions.
+static_assert(xr::to_string_literal(xr::StructureType::FrameState)[0] == 'F', "constexpr to_string_literal");
+
+static_assert(xr::enum_count<xr::ReferenceSpaceType>() == 4, "constexpr enum_count");
+static_assert(xr::enum_values<xr::ReferenceSpaceType>()[1] == xr::ReferenceSpaceType::Local, "constexpr enum_values");
+static_assert(xr::enum_index(xr::ReferenceSpaceType::UnboundedMSFT) == 3, "constexpr enum_index");
+
+// Two names whose hashes collide, which the generator gets around by picking another seed for the table.
+static_assert(xr::impl::nameHash("NAME_90203", 10, 0) == xr::impl::nameHash("NAME_256830", 11, 0), "name hash collision");
+static_assert(xr::impl::nameHash("NAME_90203", 10, 1) != xr::impl::nameHash("NAME_256830", 11, 1), "name hash seed");
+
+#if defined(OPENXR_HPP_HAS_OPTIONAL) && defined(OPENXR_HPP_HAS_STRING_VIEW)
+static_assert(xr::from_string<xr::ReferenceSpaceType>("Stage") == xr::ReferenceSpaceType::Stage, "constexpr from_string");
+static_assert(!xr::from_string<xr::ReferenceSpaceType>("Stag"), "constexpr from_string");
+#endif
+
+namespace {
+// Checks that enum_index() numbers the values of E densely, in the order of enum_values().
+template <typename E>
+void expectDenseIndices() {
+  size_t i = 0;
+  for (E value : xr::enum_values<E>()) {
+    EXPECT_EQ(xr::enum_index(value), i) << xr::to_string_literal(value);
+    ++i;
+  }
+  EXPECT_EQ(i, xr::enum_count<E>());
+}
+} // namespace
+
+class OpenXrEnumsTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrEnumsTest, toStringLiteralTest) {
+  EXPECT_STREQ(xr::to_string_literal(xr::StructureType::Unknown), "Unknown");
+  EXPECT_STREQ(xr::to_string_literal(xr::StructureType::FrameState), "FrameState");
+  EXPECT_STREQ(xr::to_string_literal(xr::StructureType::HandJointLocationsEXT), "HandJointLocationsEXT");
+  EXPECT_STREQ(xr::to_string_literal(xr::Result::Success), "Success");
+  EXPECT_STREQ(xr::to_string_literal(xr::Result::SessionLossPending), "SessionLossPending");
+  EXPECT_STREQ(xr::to_string_literal(xr::Result::ErrorSessionLost), "ErrorSessionLost");
+  EXPECT_STREQ(xr::to_string_literal(xr::Result::ErrorColorSpaceUnsupportedFB), "ErrorColorSpaceUnsupportedFB");
+  EXPECT_STREQ(xr::to_string_literal(xr::ObjectType::HandTrackerEXT), "HandTrackerEXT");
+  EXPECT_STREQ(xr::to_string_literal(xr::SessionState::Focused), "Focused");
+  EXPECT_EQ(xr::to_string(xr::ObjectType::Session), "Session");
+}
+
+TEST_F(OpenXrEnumsTest, invalidTest) {
+  // Values that are not in the enum, including ones that hash to the slot of one that is.
+  for (int32_t raw = -2000; raw <= 2000; ++raw) {
+    if (xr::to_string(static_cast<xr::Result>(raw)) != "invalid") {
+      EXPECT_TRUE(raw >= -100 && raw <= 100) << raw;
+    }
+  }
+  EXPECT_STREQ(xr::to_string_literal(static_cast<xr::StructureType>(1000051999)), "invalid");
+  EXPECT_STREQ(xr::to_string_literal(static_cast<xr::StructureType>(-1)), "invalid");
+  EXPECT_STREQ(xr::to_string_literal(static_cast<xr::ObjectType>(7)), "invalid");
+}
+
+TEST_F(OpenXrEnumsTest, fromStringTest) {
+  xr::ReferenceSpaceType space = xr::ReferenceSpaceType::View;
+  EXPECT_TRUE(xr::from_string("Stage", space));
+  EXPECT_TRUE(space == xr::ReferenceSpaceType::Stage);
+  EXPECT_TRUE(xr::from_string("XR_REFERENCE_SPACE_TYPE_UNBOUNDED_MSFT", space));
+  EXPECT_TRUE(space == xr::ReferenceSpaceType::UnboundedMSFT);
+
+  // Only whole names match, and a failed parse leaves the value alone.
+  for (const char *name : {"", "Stag", "Stages", "stage", "XR_REFERENCE_SPACE_TYPE_"}) {
+    EXPECT_FALSE(xr::from_string(name, space)) << name;
+  }
+  EXPECT_FALSE(xr::from_string("Local\0", 6, space));
+  EXPECT_TRUE(space == xr::ReferenceSpaceType::UnboundedMSFT);
+
+  xr::StructureType type = xr::StructureType::Unknown;
+  EXPECT_TRUE(xr::from_string("HandJointLocationsEXT", type));
+  EXPECT_TRUE(type == xr::StructureType::HandJointLocationsEXT);
+  xr::Result result = xr::Result::Success;
+  EXPECT_TRUE(xr::from_string("XR_ERROR_SESSION_LOST", result));
+  EXPECT_TRUE(result == xr::Result::ErrorSessionLost);
+  std::string name = "EnvironmentBlendModeAlphaBlend";
+  xr::EnvironmentBlendMode blendMode = xr::EnvironmentBlendMode::Opaque;
+  EXPECT_TRUE(xr::from_string(name.data() + 20, name.size() - 20, blendMode));
+  EXPECT_TRUE(blendMode == xr::EnvironmentBlendMode::AlphaBlend);
+
+  // Every name that to_string_literal() returns parses back to its value.
+  for (int32_t raw = -100; raw <= 100; ++raw) {
+    const char *literal = xr::to_string_literal(static_cast<xr::Result>(raw));
+    if (std::string(literal) != "invalid") {
+      EXPECT_TRUE(xr::from_string(literal, result));
+      EXPECT_EQ(xr::get(result), raw);
+    }
+  }
+
+  xr::SwapchainUsageFlagBits bit = xr::SwapchainUsageFlagBits::None;
+  EXPECT_TRUE(xr::from_string("Sampled", bit));
+  EXPECT_TRUE(bit == xr::SwapchainUsageFlagBits::Sampled);
+  EXPECT_TRUE(xr::from_string("XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT", bit));
+  EXPECT_TRUE(bit == xr::SwapchainUsageFlagBits::ColorAttachment);
+  EXPECT_FALSE(xr::from_string("AllBits", bit));
+}
+
+TEST_F(OpenXrEnumsTest, reflectionTest) {
+  expectDenseIndices<xr::Result>();
+  expectDenseIndices<xr::StructureType>();
+  expectDenseIndices<xr::ObjectType>();
+  expectDenseIndices<xr::SessionState>();
+  expectDenseIndices<xr::ViewConfigurationType>();
+  EXPECT_TRUE(xr::enum_values<xr::StructureType>()[xr::enum_index(xr::StructureType::FrameState)] ==
+              xr::StructureType::FrameState);
+
+  // Values that are not in the enum, or not compiled in, map to enum_count().
+  EXPECT_EQ(xr::enum_index(static_cast<xr::StructureType>(1000051999)), xr::enum_count<xr::StructureType>());
+  EXPECT_EQ(xr::enum_index(static_cast<xr::SessionState>(1000)), xr::enum_count<xr::SessionState>());
+  EXPECT_EQ(xr::enum_index(static_cast<xr::ViewConfigurationType>(XR_VIEW_CONFIGURATION_TYPE_PRIMARY_QUAD_VARJO)),
+            xr::enum_count<xr::ViewConfigurationType>());
+  for (xr::ViewConfigurationType value : xr::enum_values<xr::ViewConfigurationType>()) {
+    EXPECT_NE(xr::get(value), XR_VIEW_CONFIGURATION_TYPE_PRIMARY_QUAD_VARJO);
+  }
+
+  // Counters for every result, in a flat array.
+  std::array<int, xr::enum_count<xr::Result>() + 1> counters{};
+  for (int32_t raw = -2000; raw <= 2000; ++raw) {
+    ++counters[xr::enum_index(static_cast<xr::Result>(raw))];
+  }
+  for (xr::Result result : xr::enum_values<xr::Result>()) {
+    EXPECT_EQ(counters[xr::enum_index(result)], xr::get(result) >= -2000 && xr::get(result) <= 2000 ? 1 : 0);
+  }
+}
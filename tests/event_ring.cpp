@@ -0,0 +1,149 @@
+#include "openxr/openxr_event_ring.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace {
+struct PollEventDispatch {
+  std::vector<XrEventDataSessionStateChanged> pending;
+  size_t polled = 0;
+
+  XrResult xrPollEvent(XrInstance, XrEventDataBuffer *buffer) {
+    if (polled == pending.size()) {
+      return XR_EVENT_UNAVAILABLE;
+    }
+    memcpy(buffer, &pending[polled++], sizeof(XrEventDataSessionStateChanged));
+    return XR_SUCCESS;
+  }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(PollEventDispatch)
+
+class OpenXrEventRingTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+static xr::EventDataSessionStateChanged makeStateChanged(int64_t time) {
+  xr::EventDataSessionStateChanged event;
+  event.state = xr::SessionState::Focused;
+  event.time = xr::Time{time};
+  return event;
+}
+
+TEST_F(OpenXrEventRingTest, sizeTest) {
+  EXPECT_EQ(xr::eventStructSize(xr::StructureType::EventDataSessionStateChanged),
+            sizeof(XrEventDataSessionStateChanged));
+  EXPECT_EQ(xr::eventStructSize(xr::StructureType::EventDataEventsLost),
+            sizeof(XrEventDataEventsLost));
+  EXPECT_EQ(xr::eventStructSize(xr::StructureType::Unknown),
+            sizeof(XrEventDataBuffer));
+  EXPECT_EQ(xr::traits::event_type<xr::EventDataEventsLost>::value,
+            xr::StructureType::EventDataEventsLost);
+}
+
+TEST_F(OpenXrEventRingTest, typedConsumeTest) {
+  xr::EventRing<> ring;
+  EXPECT_TRUE(ring.empty());
+
+  xr::EventDataEventsLost lost;
+  lost.lostEventCount = 7;
+  EXPECT_TRUE(ring.push(*lost.get_base()));
+  EXPECT_TRUE(ring.push(*makeStateChanged(42).get_base()));
+  EXPECT_FALSE(ring.empty());
+
+  std::vector<xr::StructureType> seen;
+  size_t visited = ring.consume([&](xr::EventView const &event) {
+    seen.push_back(event.type());
+    EXPECT_EQ(event.get()->next, nullptr);
+    if (auto stateChanged = event.get_if<xr::EventDataSessionStateChanged>()) {
+      EXPECT_EQ(event.size(), sizeof(XrEventDataSessionStateChanged));
+      EXPECT_EQ(stateChanged->state, xr::SessionState::Focused);
+      EXPECT_EQ(stateChanged->time.get(), 42);
+      EXPECT_EQ(event.get_if<xr::EventDataEventsLost>(), nullptr);
+    } else if (auto eventsLost = event.get_if<xr::EventDataEventsLost>()) {
+      EXPECT_EQ(eventsLost->lostEventCount, 7u);
+    }
+  });
+  EXPECT_EQ(visited, 2u);
+  ASSERT_EQ(seen.size(), 2u);
+  EXPECT_EQ(seen[0], xr::StructureType::EventDataEventsLost);
+  EXPECT_EQ(seen[1], xr::StructureType::EventDataSessionStateChanged);
+  EXPECT_TRUE(ring.empty());
+
+  xr::EventDataBuffer buffer;
+  EXPECT_FALSE(ring.pop(buffer));
+  EXPECT_TRUE(ring.push(*makeStateChanged(3).get_base()));
+  EXPECT_TRUE(ring.pop(buffer));
+  EXPECT_EQ(buffer.type, xr::StructureType::EventDataSessionStateChanged);
+}
+
+TEST_F(OpenXrEventRingTest, fullAndWrapTest) {
+  // Smallest allowed ring: two full-size records.
+  xr::EventRing<16 * 1024> ring;
+  size_t pushed = 0;
+  while (ring.push(*makeStateChanged(int64_t(pushed)).get_base())) {
+    ++pushed;
+  }
+  EXPECT_EQ(ring.droppedCount(), 1u);
+  EXPECT_EQ(pushed, ring.capacity() / xr::impl::eventRecordSize(
+                                          sizeof(XrEventDataSessionStateChanged)));
+
+  // Interleave so that records straddle the end of the storage many times.
+  int64_t next = 0;
+  for (int64_t i = 0; i < 10000; ++i) {
+    ring.consume(
+        [&](xr::EventView const &event) {
+          auto stateChanged = event.get_if<xr::EventDataSessionStateChanged>();
+          ASSERT_NE(stateChanged, nullptr);
+          EXPECT_EQ(stateChanged->time.get(), next++);
+        },
+        1);
+    ASSERT_TRUE(ring.push(*makeStateChanged(int64_t(pushed) + i).get_base()));
+  }
+  EXPECT_EQ(ring.droppedCount(), 1u);
+}
+
+TEST_F(OpenXrEventRingTest, threadedTest) {
+  static const int64_t count = 100000;
+  xr::EventRing<> ring;
+  std::thread producer([&] {
+    for (int64_t i = 0; i < count; ++i) {
+      while (!ring.push(*makeStateChanged(i).get_base())) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int64_t next = 0;
+  while (next < count) {
+    ring.consume([&](xr::EventView const &event) {
+      EXPECT_EQ(event.get_if<xr::EventDataSessionStateChanged>()->time.get(),
+                next++);
+    });
+  }
+  producer.join();
+  EXPECT_TRUE(ring.empty());
+}
+
+TEST_F(OpenXrEventRingTest, pollFromTest) {
+  PollEventDispatch d;
+  for (int64_t i = 0; i < 3; ++i) {
+    d.pending.push_back(makeStateChanged(i));
+  }
+  xr::EventRing<> ring;
+  EXPECT_TRUE(ring.pollFrom(xr::Instance{}, d) == xr::Result::EventUnavailable);
+  EXPECT_EQ(ring.consume([](xr::EventView const &) {}), 3u);
+
+  // A ring too full to take a full-size event stops without polling.
+  xr::EventRing<16 * 1024> small;
+  while (small.push(*makeStateChanged(0).get_base())) {
+  }
+  d.polled = 0;
+  EXPECT_TRUE(small.pollFrom(xr::Instance{}, d) == xr::Result::Success);
+  EXPECT_EQ(d.polled, 0u);
+}
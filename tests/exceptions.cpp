@@ -0,0 +1,74 @@
+#include "openxr/openxr.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#ifndef OPENXR_HPP_NO_EXCEPTIONS
+
+namespace {
+struct FailingDispatch {
+  XrResult xrWaitFrame(XrSession, const XrFrameWaitInfo *, XrFrameState *) const { return XR_ERROR_SESSION_LOST; }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(FailingDispatch)
+
+class OpenXrExceptionsTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrExceptionsTest, wrapperTest) {
+  try {
+    xr::Session{}.waitFrame(xr::FrameWaitInfo{}, FailingDispatch{});
+    FAIL() << "waitFrame did not throw";
+  } catch (xr::exceptions::SessionLostError const &e) {
+    EXPECT_TRUE(e.result() == xr::Result::ErrorSessionLost);
+    EXPECT_TRUE(e.command() == xr::CommandId::WaitFrame);
+    EXPECT_STREQ(xr::to_string_literal(e.command()), "xrWaitFrame");
+    EXPECT_STREQ(e.function(), "xr::Session::waitFrame");
+    EXPECT_STREQ(e.what(), "xr::Session::waitFrame: ErrorSessionLost");
+    EXPECT_EQ(e.code().value(), XR_ERROR_SESSION_LOST);
+    EXPECT_STREQ(e.code().category().name(), "xr::Result");
+  }
+}
+
+TEST_F(OpenXrExceptionsTest, mappingTest) {
+  // Each error result throws its own exception class.
+  try {
+    xr::exceptions::throwResultException(xr::Result::ErrorValidationFailure, "first");
+  } catch (xr::exceptions::ValidationFailureError const &e) {
+    EXPECT_STREQ(e.what(), "first: ErrorValidationFailure");
+    EXPECT_TRUE(e.command() == xr::CommandId::Unknown);
+  }
+  try {
+    xr::exceptions::throwResultException(xr::Result::ErrorFormFactorUnavailable, "second", xr::CommandId::StringToPath);
+  } catch (xr::exceptions::FormFactorUnavailableError const &e) {
+    EXPECT_TRUE(e.command() == xr::CommandId::StringToPath);
+  }
+
+  // Results without an exception class of their own throw a SystemError.
+  try {
+    xr::exceptions::throwResultException(static_cast<xr::Result>(-999), nullptr);
+  } catch (xr::exceptions::Error const &e) {
+    EXPECT_TRUE(dynamic_cast<xr::exceptions::SystemError const *>(&e)->result() == static_cast<xr::Result>(-999));
+    EXPECT_STREQ(e.what(), "invalid");
+  }
+  try {
+    xr::exceptions::throwResultException(xr::Result::SessionLossPending, "third");
+  } catch (std::exception const &e) {
+    EXPECT_STREQ(e.what(), "third: SessionLossPending");
+  }
+}
+
+TEST_F(OpenXrExceptionsTest, longNameTest) {
+  // The message is cut short rather than overflowing its buffer.
+  static const std::string name(1000, 'x');
+  xr::exceptions::SystemError error(xr::Result::ErrorRuntimeFailure, name.c_str());
+  EXPECT_EQ(std::string(error.what()), name.substr(0, 255));
+}
+
+#endif // !OPENXR_HPP_NO_EXCEPTIONS
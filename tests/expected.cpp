@@ -0,0 +1,169 @@
+#define OPENXR_HPP_EXPECTED
+#include "openxr/openxr.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace {
+// A runtime that knows a single path, and fails to create spaces once out of them.
+struct PathDispatch {
+  int spacesLeft = 1;
+  // Shared with the copy of the dispatch held by each UniqueHandle.
+  int *destroyedSpaces = nullptr;
+
+  XrResult xrStringToPath(XrInstance, const char *pathString, XrPath *path) {
+    if (std::strcmp(pathString, "/user/hand/left") != 0) {
+      return XR_ERROR_PATH_FORMAT_INVALID;
+    }
+    *path = 42;
+    return XR_SUCCESS;
+  }
+
+  XrResult xrPathToString(XrInstance, XrPath path, uint32_t capacity, uint32_t *count, char *buffer) {
+    if (path != 42) {
+      return XR_ERROR_PATH_INVALID;
+    }
+    static const char name[] = "/user/hand/left";
+    *count = sizeof(name);
+    if (capacity == 0) {
+      return XR_SUCCESS;
+    }
+    if (capacity < sizeof(name)) {
+      return XR_ERROR_SIZE_INSUFFICIENT;
+    }
+    std::memcpy(buffer, name, sizeof(name));
+    return XR_SUCCESS;
+  }
+
+  XrResult xrCreateReferenceSpace(XrSession, const XrReferenceSpaceCreateInfo *, XrSpace *space) {
+    if (spacesLeft == 0) {
+      return XR_ERROR_LIMIT_REACHED;
+    }
+    --spacesLeft;
+    *space = reinterpret_cast<XrSpace>(uintptr_t(7));
+    return XR_SUCCESS;
+  }
+
+  XrResult xrDestroySpace(XrSpace) const {
+    ++*destroyedSpaces;
+    return XR_SUCCESS;
+  }
+};
+
+// Counts copies, to check that failures construct nothing.
+struct Tracked {
+  static int live;
+  int value;
+  explicit Tracked(int v) : value(v) { ++live; }
+  Tracked(Tracked const &other) : value(other.value) { ++live; }
+  ~Tracked() { --live; }
+};
+int Tracked::live = 0;
+
+// Throws from its copy constructor once armed, like a vector that runs out of memory.
+struct ThrowingCopy {
+  static int live;
+  static bool throwOnCopy;
+  int value;
+  explicit ThrowingCopy(int v) : value(v) { ++live; }
+  ThrowingCopy(ThrowingCopy const &other) : value(other.value) {
+    if (throwOnCopy) {
+      throw std::bad_alloc();
+    }
+    ++live;
+  }
+  ~ThrowingCopy() { --live; }
+};
+int ThrowingCopy::live = 0;
+bool ThrowingCopy::throwOnCopy = false;
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(PathDispatch)
+
+class OpenXrExpectedTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrExpectedTest, expectedTest) {
+  {
+    xr::Expected<Tracked> value{Tracked{3}};
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(value->value, 3);
+    EXPECT_EQ(Tracked::live, 1);
+    xr::Expected<Tracked> copy = value;
+    EXPECT_EQ((*copy).value, 3);
+    EXPECT_EQ(Tracked::live, 2);
+
+    xr::Expected<Tracked> error{xr::Unexpected{xr::Result::ErrorValidationFailure}};
+    EXPECT_FALSE(error);
+    EXPECT_TRUE(error.error() == xr::Result::ErrorValidationFailure);
+    EXPECT_EQ(error.value_or(Tracked{5}).value, 5);
+    EXPECT_EQ(Tracked::live, 2);
+
+    copy = error;
+    EXPECT_FALSE(copy.has_value());
+    EXPECT_EQ(Tracked::live, 1);
+  }
+  EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST_F(OpenXrExpectedTest, throwingCopyTest) {
+  {
+    xr::Expected<ThrowingCopy> target{ThrowingCopy{1}};
+    xr::Expected<ThrowingCopy> source{ThrowingCopy{2}};
+    EXPECT_EQ(ThrowingCopy::live, 2);
+    ThrowingCopy::throwOnCopy = true;
+    EXPECT_THROW(target = source, std::bad_alloc);
+    ThrowingCopy::throwOnCopy = false;
+    // Whatever target holds now, it is destroyed exactly once below.
+    EXPECT_EQ(ThrowingCopy::live, target.has_value() ? 2 : 1);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST_F(OpenXrExpectedTest, valueTest) {
+  PathDispatch d;
+  xr::Instance instance;
+  xr::Expected<xr::Path> path = instance.stringToPath("/user/hand/left", d);
+  ASSERT_TRUE(path.has_value());
+  EXPECT_EQ(path->get(), 42u);
+
+  path = instance.stringToPath("not a path", d);
+  ASSERT_FALSE(path.has_value());
+  EXPECT_TRUE(path.error() == xr::Result::ErrorPathFormatInvalid);
+}
+
+TEST_F(OpenXrExpectedTest, twoCallTest) {
+  PathDispatch d;
+  xr::Instance instance;
+  xr::Expected<std::string> name = instance.pathToString(xr::Path{42}, d);
+  ASSERT_TRUE(name.has_value());
+  EXPECT_STREQ(name->c_str(), "/user/hand/left");
+
+  name = instance.pathToString(xr::Path{7}, d);
+  ASSERT_FALSE(name.has_value());
+  EXPECT_TRUE(name.error() == xr::Result::ErrorPathInvalid);
+}
+
+TEST_F(OpenXrExpectedTest, uniqueTest) {
+  int destroyedSpaces = 0;
+  PathDispatch d;
+  d.destroyedSpaces = &destroyedSpaces;
+  xr::Session session;
+  {
+    auto space = session.createReferenceSpaceUnique(xr::ReferenceSpaceCreateInfo{}, d);
+    ASSERT_TRUE(space.has_value());
+    EXPECT_TRUE(space->get() == reinterpret_cast<XrSpace>(uintptr_t(7)));
+
+    auto failed = session.createReferenceSpaceUnique(xr::ReferenceSpaceCreateInfo{}, d);
+    ASSERT_FALSE(failed.has_value());
+    EXPECT_TRUE(failed.error() == xr::Result::ErrorLimitReached);
+  }
+  EXPECT_EQ(destroyedSpaces, 1);
+}
@@ -1,5 +1,7 @@
 #include "openxr/openxr.hpp"
+#include <iterator>
 #include <type_traits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -68,3 +70,85 @@ TEST_F(OpenXrFlagsTest, flagsTest) {
     EXPECT_TRUE((std::is_same<decltype(flags), xr::SpaceVelocityFlags>::value));
   }
 }
+
+// Flag constants fold in constant expressions.
+static_assert((xr::SwapchainUsageFlagBits::ColorAttachment | xr::SwapchainUsageFlagBits::Sampled).get() ==
+                  (XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT | XR_SWAPCHAIN_USAGE_SAMPLED_BIT),
+              "constexpr Flags");
+static_assert((xr::SpaceLocationFlagBits::PositionValid | xr::SpaceLocationFlagBits::OrientationValid).count() == 2,
+              "constexpr count");
+static_assert(!(~xr::SpaceLocationFlags(xr::SpaceLocationFlagBits::PositionValid))
+                   .any(xr::SpaceLocationFlagBits::PositionValid),
+              "constexpr any");
+
+TEST_F(OpenXrFlagsTest, maskTest) {
+  const xr::SpaceLocationFlags valid = xr::SpaceLocationFlagBits::PositionValid |
+                                       xr::SpaceLocationFlagBits::OrientationValid;
+  xr::SpaceLocationFlags flags = xr::SpaceLocationFlagBits::PositionValid |
+                                 xr::SpaceLocationFlagBits::PositionTracked;
+  EXPECT_TRUE(flags.any());
+  EXPECT_TRUE(flags.any(valid));
+  EXPECT_FALSE(flags.all(valid));
+  EXPECT_FALSE(flags.none(valid));
+  EXPECT_FALSE(flags.all());
+  flags |= xr::SpaceLocationFlagBits::OrientationValid;
+  EXPECT_TRUE(flags.all(valid));
+  EXPECT_TRUE(flags.none(xr::SpaceLocationFlagBits::OrientationTracked));
+  EXPECT_EQ(flags.count(), 3u);
+  EXPECT_TRUE((~xr::SpaceLocationFlags()).all());
+  EXPECT_TRUE(xr::SpaceLocationFlags().none());
+  EXPECT_EQ(xr::SpaceLocationFlags().count(), 0u);
+}
+
+TEST_F(OpenXrFlagsTest, iterationTest) {
+  xr::SwapchainUsageFlags flags = xr::SwapchainUsageFlagBits::MutableFormat |
+                                  xr::SwapchainUsageFlagBits::ColorAttachment |
+                                  xr::SwapchainUsageFlagBits::TransferSrc;
+  std::vector<xr::SwapchainUsageFlagBits> bits(flags.begin(), flags.end());
+  ASSERT_EQ(bits.size(), 3u);
+  EXPECT_EQ(bits[0], xr::SwapchainUsageFlagBits::ColorAttachment);
+  EXPECT_EQ(bits[1], xr::SwapchainUsageFlagBits::TransferSrc);
+  EXPECT_EQ(bits[2], xr::SwapchainUsageFlagBits::MutableFormat);
+
+  int visited = 0;
+  for (xr::SwapchainUsageFlagBits bit : xr::SwapchainUsageFlags()) {
+    (void)bit;
+    ++visited;
+  }
+  EXPECT_EQ(visited, 0);
+
+  // Bits above those of the type are still visited.
+  xr::SwapchainUsageFlags high(uint64_t(1) << 63);
+  ASSERT_EQ(std::distance(high.begin(), high.end()), 1);
+  EXPECT_EQ(uint64_t(*high.begin()), uint64_t(1) << 63);
+}
+
+TEST_F(OpenXrFlagsTest, bitCountTest) {
+  static_assert(xr::impl::popCount(0) == 0, "constexpr popCount");
+  static_assert(xr::impl::countTrailingZeros(uint64_t(1) << 40) == 40, "constexpr countTrailingZeros");
+  for (uint64_t x : {uint64_t(0), uint64_t(1), uint64_t(0x80), uint64_t(0xF0F0), ~uint64_t(0),
+                     uint64_t(1) << 63, uint64_t(0x8000000000000001)}) {
+    uint32_t bits = 0;
+    uint32_t lowest = 64;
+    for (uint32_t i = 0; i < 64; ++i) {
+      if ((x >> i) & 1) {
+        ++bits;
+        lowest = lowest < i ? lowest : i;
+      }
+    }
+    EXPECT_EQ(xr::impl::popCount(x), bits) << x;
+    EXPECT_EQ(xr::impl::countTrailingZeros(x), lowest) << x;
+  }
+}
+
+TEST_F(OpenXrFlagsTest, stringTest) {
+  EXPECT_STREQ(xr::to_string_literal(xr::SwapchainUsageFlagBits::Sampled), "Sampled");
+  EXPECT_STREQ(xr::to_string_literal(xr::SwapchainUsageFlagBits::None), "None");
+  EXPECT_STREQ(xr::to_string_literal(xr::SwapchainUsageFlagBits::AllBits), "invalid");
+  EXPECT_EQ(xr::to_string(xr::SpaceLocationFlagBits::PositionTracked), "PositionTracked");
+  EXPECT_EQ(xr::to_string(xr::SwapchainUsageFlagBits::ColorAttachment |
+                          xr::SwapchainUsageFlagBits::Sampled),
+            "ColorAttachment | Sampled");
+  EXPECT_EQ(xr::to_string(xr::SwapchainUsageFlags()), "None");
+  EXPECT_EQ(xr::to_string(xr::SwapchainUsageFlags(uint64_t(1) << 40)), "invalid");
+}
@@ -0,0 +1,121 @@
+#if defined(__has_include)
+#if __has_include(<fmt/format.h>)
+#define FMT_HEADER_ONLY
+#define OPENXR_HPP_FMT
+#endif
+#endif
+
+#include "openxr/openxr_format.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace {
+template <typename T>
+std::string formatted(T const &value) {
+  char text[512];
+  size_t length = xr::format_to(text, value);
+  EXPECT_LT(length, sizeof(text));
+  EXPECT_EQ(std::string(text).size(), length);
+  return text;
+}
+} // namespace
+
+class OpenXrFormatTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrFormatTest, scalarTest) {
+  EXPECT_EQ(formatted(uint32_t(42)), "42");
+  EXPECT_EQ(formatted(int64_t(INT64_MIN)), "-9223372036854775808");
+  EXPECT_EQ(formatted(1.5f), "1.5");
+  EXPECT_EQ(formatted(-2.0f), "-2");
+  EXPECT_EQ(formatted(xr::Bool32{true}), "true");
+  EXPECT_EQ(formatted(xr::Time{1500}), "1500");
+  EXPECT_EQ(formatted(xr::Duration{-1}), "-1");
+  EXPECT_EQ(formatted(xr::Version{1, 0, 34}), "1.0.34");
+  EXPECT_EQ(xr::to_string(xr::Version{1, 0, 34}), "1.0.34");
+  EXPECT_EQ(formatted(xr::Path{0x2a}), "0x2a");
+  EXPECT_EQ(formatted(xr::Space{}), "0x0");
+  const float values[3] = {1, 0.25f, 3};
+  EXPECT_EQ(formatted(values), "[1, 0.25, 3]");
+}
+
+TEST_F(OpenXrFormatTest, enumTest) {
+  EXPECT_EQ(formatted(xr::Result::ErrorSessionLost), "ErrorSessionLost");
+  EXPECT_EQ(formatted(xr::StructureType::SpaceLocation), "SpaceLocation");
+  EXPECT_EQ(formatted(static_cast<xr::Result>(-999)), "-999");
+
+  EXPECT_EQ(formatted(xr::SpaceLocationFlags{}), "None");
+  EXPECT_EQ(formatted(xr::SpaceLocationFlagBits::PositionValid | xr::SpaceLocationFlagBits::OrientationValid),
+            "OrientationValid | PositionValid");
+  EXPECT_EQ(formatted(xr::SpaceLocationFlagBits::PositionTracked), "PositionTracked");
+  EXPECT_EQ(formatted(xr::SpaceLocationFlags{XR_SPACE_LOCATION_POSITION_VALID_BIT | 0x100}), "PositionValid | 0x100");
+}
+
+TEST_F(OpenXrFormatTest, structTest) {
+  EXPECT_EQ(formatted(xr::Posef{}), "{orientation: {x: 0, y: 0, z: 0, w: 1}, position: {x: 0, y: 0, z: 0}}");
+
+  xr::SpaceLocation location;
+  location.locationFlags = xr::SpaceLocationFlagBits::OrientationValid;
+  location.pose.position = xr::Vector3f{1.5f, 0, -2};
+  // type and next are left out.
+  EXPECT_EQ(formatted(location), "{locationFlags: OrientationValid, pose: {orientation: {x: 0, y: 0, z: 0, w: 1}, "
+                                 "position: {x: 1.5, y: 0, z: -2}}}");
+
+  xr::FrameState state;
+  state.predictedDisplayTime = xr::Time{1000};
+  state.predictedDisplayPeriod = xr::Duration{11};
+  state.shouldRender = true;
+  EXPECT_EQ(formatted(state), "{predictedDisplayTime: 1000, predictedDisplayPeriod: 11, shouldRender: true}");
+
+  xr::ApplicationInfo info{"app", 1, "engine", 2, xr::Version{1, 0, 0}};
+  EXPECT_EQ(formatted(info), "{applicationName: \"app\", applicationVersion: 1, engineName: \"engine\", "
+                             "engineVersion: 2, apiVersion: 1.0.0}");
+
+  // Counted arrays are written as addresses, since their pointers may not be valid to read.
+  xr::FrameEndInfo endInfo;
+  EXPECT_EQ(formatted(endInfo),
+            "{displayTime: 0, environmentBlendMode: 0, layerCount: 0, layers: null}");
+
+  EXPECT_EQ(formatted(xr::FrameBeginInfo{}), "{}");
+}
+
+TEST_F(OpenXrFormatTest, truncationTest) {
+  const xr::Posef pose;
+  const size_t length = xr::format_to(nullptr, 0, pose);
+  EXPECT_EQ(length, formatted(pose).size());
+
+  char text[8] = "xxxxxxx";
+  EXPECT_EQ(xr::format_to(text, 5, pose), length);
+  EXPECT_STREQ(text, "{ori");
+  EXPECT_EQ(text[5], 'x');
+}
+
+TEST_F(OpenXrFormatTest, iteratorTest) {
+  // Longer than the stack buffer, so that it passes through in pieces.
+  xr::ActionCreateInfo info;
+  std::string name(XR_MAX_LOCALIZED_ACTION_NAME_SIZE - 1, 'a');
+  strncpy(info.localizedActionName, name.c_str(), XR_MAX_LOCALIZED_ACTION_NAME_SIZE);
+  std::string text;
+  xr::impl::formatToIterator(std::back_inserter(text), info);
+  EXPECT_EQ(text.size(), xr::format_to(nullptr, 0, info));
+  EXPECT_NE(text.find(name), std::string::npos);
+}
+
+#ifdef OPENXR_HPP_HAS_STD_FORMAT
+TEST_F(OpenXrFormatTest, stdFormatTest) {
+  EXPECT_EQ(std::format("{} at {}", xr::Result::Success, xr::Vector3f{1, 2, 3}), "Success at {x: 1, y: 2, z: 3}");
+}
+#endif
+
+#ifdef OPENXR_HPP_FMT
+TEST_F(OpenXrFormatTest, fmtTest) {
+  EXPECT_EQ(fmt::format("{} at {}", xr::Result::Success, xr::Vector3f{1, 2, 3}), "Success at {x: 1, y: 2, z: 3}");
+  EXPECT_EQ(fmt::format("{}", xr::SpaceLocationFlagBits::PositionValid), "PositionValid");
+}
+#endif
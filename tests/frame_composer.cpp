@@ -0,0 +1,88 @@
+#include "openxr/openxr_frame_composer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+struct EndFrameDispatch {
+  std::vector<XrStructureType> layerTypes;
+  std::vector<float> firstViewX;
+  const void *firstViewNext = nullptr;
+  uint32_t calls = 0;
+
+  XrResult xrEndFrame(XrSession, const XrFrameEndInfo *info) {
+    ++calls;
+    layerTypes.clear();
+    for (uint32_t i = 0; i < info->layerCount; ++i) {
+      layerTypes.push_back(info->layers[i]->type);
+      if (info->layers[i]->type == XR_TYPE_COMPOSITION_LAYER_PROJECTION) {
+        auto projection = reinterpret_cast<const XrCompositionLayerProjection *>(info->layers[i]);
+        firstViewX.push_back(projection->views[0].pose.position.x);
+        firstViewNext = projection->views[0].next;
+      }
+    }
+    return info->displayTime == 0 ? XR_ERROR_TIME_INVALID : XR_SUCCESS;
+  }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(EndFrameDispatch)
+
+class OpenXrFrameComposerTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrFrameComposerTest, composeTest) {
+  EndFrameDispatch d;
+  xr::FrameComposer<> composer;
+  uint32_t world = composer.addProjectionLayer(xr::Space{}, 2);
+  uint32_t hud = composer.addQuadLayer(xr::Space{}, xr::EyeVisibility::Left);
+  EXPECT_EQ(world, 0u);
+  EXPECT_EQ(hud, 1u);
+  EXPECT_EQ(composer.enabledLayerCount(), 2u);
+  EXPECT_TRUE(composer.quadLayer(hud).eyeVisibility == xr::EyeVisibility::Left);
+
+  const xr::CompositionLayerBaseHeader *const *layers = nullptr;
+  for (int frame = 1; frame <= 3; ++frame) {
+    composer.projectionView(world, 0).pose.position.x = float(frame);
+    EXPECT_TRUE(composer.endFrame(xr::Session{}, xr::Time{frame}, xr::EnvironmentBlendMode::Opaque, d) ==
+                xr::Result::Success);
+    // The layer list is stable across frames.
+    const xr::FrameEndInfo &info = composer.frameEndInfo(xr::Time{frame}, xr::EnvironmentBlendMode::Opaque);
+    if (layers != nullptr) {
+      EXPECT_EQ(info.layers, layers);
+    }
+    layers = info.layers;
+  }
+  ASSERT_EQ(d.layerTypes.size(), 2u);
+  EXPECT_EQ(d.layerTypes[0], XR_TYPE_COMPOSITION_LAYER_PROJECTION);
+  EXPECT_EQ(d.layerTypes[1], XR_TYPE_COMPOSITION_LAYER_QUAD);
+  EXPECT_EQ(d.firstViewX, (std::vector<float>{1.f, 2.f, 3.f}));
+
+  composer.setLayerEnabled(world, false);
+  composer.endFrame(xr::Session{}, xr::Time{4}, xr::EnvironmentBlendMode::Opaque, d);
+  ASSERT_EQ(d.layerTypes.size(), 1u);
+  EXPECT_EQ(d.layerTypes[0], XR_TYPE_COMPOSITION_LAYER_QUAD);
+
+  composer.setLayerEnabled(world, true);
+  composer.depthInfo(world, 0).nearZ = 0.1f;
+  composer.endFrame(xr::Session{}, xr::Time{5}, xr::EnvironmentBlendMode::Opaque, d);
+  ASSERT_NE(d.firstViewNext, nullptr);
+  EXPECT_EQ(static_cast<const XrCompositionLayerDepthInfoKHR *>(d.firstViewNext)->nearZ, 0.1f);
+
+  EXPECT_TRUE(composer.endFrame(xr::Session{}, xr::Time{0}, xr::EnvironmentBlendMode::Opaque, d) ==
+              xr::Result::ErrorTimeInvalid);
+  composer.clear();
+  EXPECT_EQ(composer.enabledLayerCount(), 0u);
+  EXPECT_EQ(composer.frameEndInfo(xr::Time{6}, xr::EnvironmentBlendMode::Opaque).layers, nullptr);
+
+  // A projection layer added again in the same place does not inherit the depth info chained before.
+  world = composer.addProjectionLayer(xr::Space{}, 2);
+  EXPECT_EQ(composer.projectionView(world, 0).pose.position.x, 0.f);
+  composer.endFrame(xr::Session{}, xr::Time{7}, xr::EnvironmentBlendMode::Opaque, d);
+  EXPECT_EQ(d.firstViewNext, nullptr);
+}
@@ -0,0 +1,243 @@
+#include "openxr/openxr_frame_pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace {
+constexpr XrTime kFirstDisplayTime = 1000000000;
+constexpr XrDuration kPeriod = 11111111;
+
+// A runtime with a fixed display period that checks the ordering of frame calls.
+struct FrameLoopDispatch {
+  std::mutex mutex;
+  std::condition_variable changed;
+  uint64_t waits = 0;
+  uint64_t begins = 0;
+  uint64_t ends = 0;
+  uint64_t failAtWait = 0;
+  bool outOfOrder = false;
+  bool requireOverlap = false;
+  bool overlapTimedOut = false;
+  XrTime lastEndTime = 0;
+
+  XrResult xrWaitFrame(XrSession, const XrFrameWaitInfo *info, XrFrameState *state) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (info->type != XR_TYPE_FRAME_WAIT_INFO || state->type != XR_TYPE_FRAME_STATE || waits != begins) {
+      outOfOrder = true;
+    }
+    if (waits + 1 == failAtWait) {
+      return XR_ERROR_SESSION_LOST;
+    }
+    ++waits;
+    state->predictedDisplayTime = kFirstDisplayTime + XrTime(waits) * kPeriod;
+    state->predictedDisplayPeriod = kPeriod;
+    state->shouldRender = XR_TRUE;
+    changed.notify_all();
+    return XR_SUCCESS;
+  }
+
+  XrResult xrBeginFrame(XrSession, const XrFrameBeginInfo *info) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (info->type != XR_TYPE_FRAME_BEGIN_INFO || begins != ends || begins + 1 != waits) {
+      outOfOrder = true;
+    }
+    ++begins;
+    return XR_SUCCESS;
+  }
+
+  XrResult xrEndFrame(XrSession, const XrFrameEndInfo *info) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (ends + 1 != begins) {
+      outOfOrder = true;
+    }
+    // Only returns once the next frame has been waited for, which deadlocks unless the two overlap.
+    if (requireOverlap && !changed.wait_for(lock, std::chrono::seconds(5), [&] { return waits > begins; })) {
+      overlapTimedOut = true;
+    }
+    ++ends;
+    lastEndTime = info->displayTime;
+    return XR_SUCCESS;
+  }
+};
+
+// Passed by value into the pipeline, so that the test can inspect the runtime.
+struct FrameLoopDispatchRef {
+  FrameLoopDispatch *runtime;
+
+  XrResult xrWaitFrame(XrSession session, const XrFrameWaitInfo *info, XrFrameState *state) const {
+    return runtime->xrWaitFrame(session, info, state);
+  }
+  XrResult xrBeginFrame(XrSession session, const XrFrameBeginInfo *info) const {
+    return runtime->xrBeginFrame(session, info);
+  }
+  XrResult xrEndFrame(XrSession session, const XrFrameEndInfo *info) const {
+    return runtime->xrEndFrame(session, info);
+  }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(FrameLoopDispatchRef)
+
+class OpenXrFramePipelineTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrFramePipelineTest, tripleBufferTest) {
+  xr::TripleBuffer<int> buffer;
+  EXPECT_FALSE(buffer.update());
+  for (int i = 1; i <= 3; ++i) {
+    buffer.writeBuffer() = i;
+    buffer.publish();
+  }
+  EXPECT_TRUE(buffer.hasUpdate());
+  EXPECT_TRUE(buffer.update());
+  EXPECT_EQ(buffer.readBuffer(), 3);
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(buffer.readBuffer(), 3);
+
+  buffer.writeBuffer() = 4;
+  buffer.publish();
+  EXPECT_TRUE(buffer.update());
+  EXPECT_EQ(buffer.readBuffer(), 4);
+}
+
+TEST_F(OpenXrFramePipelineTest, frameLoopTest) {
+  FrameLoopDispatch runtime;
+  xr::FramePipeline<FrameLoopDispatchRef> pipeline(xr::Session{}, FrameLoopDispatchRef{&runtime});
+  pipeline.start();
+  for (uint64_t i = 1; i <= 50; ++i) {
+    xr::PipelinedFrame frame;
+    ASSERT_TRUE(pipeline.acquireFrame(frame));
+    EXPECT_EQ(frame.index, i);
+    EXPECT_EQ(frame.state.predictedDisplayTime.get(), kFirstDisplayTime + XrTime(i) * kPeriod);
+    EXPECT_EQ(frame.state.predictedDisplayPeriod.get(), kPeriod);
+    EXPECT_TRUE(pipeline.beginFrame(frame) == xr::Result::Success);
+    xr::FrameEndInfo endInfo;
+    endInfo.displayTime = frame.state.predictedDisplayTime;
+    EXPECT_TRUE(pipeline.endFrame(frame, endInfo) == xr::Result::Success);
+    EXPECT_EQ(runtime.lastEndTime, frame.state.predictedDisplayTime.get());
+  }
+  // The pacing thread waits for the frame after the last one begun.
+  xr::PipelinedFrame next;
+  ASSERT_TRUE(pipeline.acquireFrame(next));
+  EXPECT_EQ(next.index, 51u);
+  pipeline.stop();
+  EXPECT_FALSE(runtime.outOfOrder);
+  EXPECT_EQ(runtime.begins, 50u);
+  EXPECT_EQ(runtime.ends, 50u);
+  EXPECT_EQ(runtime.waits, 51u);
+  EXPECT_EQ(pipeline.waitedFrameCount(), 51u);
+}
+
+TEST_F(OpenXrFramePipelineTest, overlapTest) {
+  FrameLoopDispatch runtime;
+  runtime.requireOverlap = true;
+  xr::FramePipeline<FrameLoopDispatchRef> pipeline(xr::Session{}, FrameLoopDispatchRef{&runtime});
+
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::deque<xr::PipelinedFrame> toRender;
+  bool done = false;
+  std::thread renderThread([&] {
+    for (;;) {
+      xr::PipelinedFrame frame;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&] { return done || !toRender.empty(); });
+        if (toRender.empty()) {
+          return;
+        }
+        frame = toRender.front();
+        toRender.pop_front();
+      }
+      pipeline.beginFrame(frame);
+      xr::FrameEndInfo endInfo;
+      endInfo.displayTime = frame.state.predictedDisplayTime;
+      pipeline.endFrame(frame, endInfo);
+    }
+  });
+
+  pipeline.start();
+  for (uint64_t i = 1; i <= 30; ++i) {
+    xr::PipelinedFrame frame;
+    ASSERT_TRUE(pipeline.acquireFrame(frame));
+    EXPECT_EQ(frame.index, i);
+    std::lock_guard<std::mutex> lock(mutex);
+    toRender.push_back(frame);
+    changed.notify_all();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    done = true;
+    changed.notify_all();
+  }
+  renderThread.join();
+  pipeline.stop();
+
+  EXPECT_FALSE(runtime.outOfOrder);
+  EXPECT_FALSE(runtime.overlapTimedOut);
+  EXPECT_EQ(runtime.ends, 30u);
+  EXPECT_EQ(runtime.lastEndTime, kFirstDisplayTime + 30 * kPeriod);
+}
+
+TEST_F(OpenXrFramePipelineTest, waitFailureTest) {
+  FrameLoopDispatch runtime;
+  runtime.failAtWait = 4;
+  xr::FramePipeline<FrameLoopDispatchRef> pipeline(xr::Session{}, FrameLoopDispatchRef{&runtime});
+  pipeline.start();
+  xr::PipelinedFrame frame;
+  uint64_t frames = 0;
+  while (pipeline.acquireFrame(frame)) {
+    ++frames;
+    pipeline.beginFrame(frame);
+    pipeline.endFrame(frame, xr::FrameEndInfo{});
+  }
+  EXPECT_EQ(frames, 3u);
+  EXPECT_TRUE(pipeline.waitResult() == xr::Result::ErrorSessionLost);
+
+  // Restarting begins a new sequence of frames.
+  runtime.failAtWait = 0;
+  pipeline.stop();
+  pipeline.start();
+  ASSERT_TRUE(pipeline.acquireFrame(frame));
+  EXPECT_EQ(frame.index, 1u);
+  EXPECT_TRUE(pipeline.waitResult() == xr::Result::Success);
+}
+
+TEST_F(OpenXrFramePipelineTest, stopWakesAcquireTest) {
+  FrameLoopDispatch runtime;
+  xr::FramePipeline<FrameLoopDispatchRef> pipeline(xr::Session{}, FrameLoopDispatchRef{&runtime});
+  pipeline.start();
+  xr::PipelinedFrame frame;
+  ASSERT_TRUE(pipeline.acquireFrame(frame));
+  // Frame 1 never begins, so frame 2 never arrives until the pipeline is stopped.
+  std::thread stopper([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pipeline.stop();
+  });
+  EXPECT_FALSE(pipeline.acquireFrame(frame));
+  stopper.join();
+  EXPECT_EQ(runtime.waits, 1u);
+  EXPECT_FALSE(runtime.outOfOrder);
+}
+
+TEST_F(OpenXrFramePipelineTest, acquireBeforeStartTest) {
+  FrameLoopDispatch runtime;
+  xr::FramePipeline<FrameLoopDispatchRef> pipeline(xr::Session{}, FrameLoopDispatchRef{&runtime});
+  EXPECT_TRUE(pipeline.stopped());
+  xr::PipelinedFrame frame;
+  EXPECT_FALSE(pipeline.acquireFrame(frame));
+  EXPECT_EQ(runtime.waits, 0u);
+
+  pipeline.start();
+  ASSERT_TRUE(pipeline.acquireFrame(frame));
+  EXPECT_EQ(frame.index, 1u);
+}
@@ -0,0 +1,208 @@
+#include "openxr/openxr_frame_timing.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace {
+constexpr XrTime kFirstDisplayTime = 1000000000;
+constexpr XrDuration kPeriod = 11111111;
+
+// A runtime that skips a display period on every third frame and asks not to render every fourth.
+struct FrameDispatch {
+  int waits = 0;
+  int begins = 0;
+  int ends = 0;
+  XrResult endResult = XR_SUCCESS;
+  XrTime displayTime = kFirstDisplayTime;
+
+  XrResult xrWaitFrame(XrSession, const XrFrameWaitInfo *, XrFrameState *state) {
+    ++waits;
+    displayTime += waits % 3 == 0 ? 2 * kPeriod : kPeriod;
+    state->predictedDisplayTime = displayTime;
+    state->predictedDisplayPeriod = kPeriod;
+    state->shouldRender = waits % 4 == 0 ? XR_FALSE : XR_TRUE;
+    return XR_SUCCESS;
+  }
+  XrResult xrBeginFrame(XrSession, const XrFrameBeginInfo *) {
+    ++begins;
+    return XR_SUCCESS;
+  }
+  XrResult xrEndFrame(XrSession, const XrFrameEndInfo *) {
+    ++ends;
+    return endResult;
+  }
+};
+
+xr::FrameTimingSample makeSample(XrTime displayTime, int64_t waitNs, int64_t cpuNs, bool shouldRender = true) {
+  xr::FrameTimingSample sample;
+  sample.predictedDisplayTime = xr::Time{displayTime};
+  sample.predictedDisplayPeriod = xr::Duration{kPeriod};
+  sample.waitTime = xr::Duration{waitNs};
+  sample.cpuTime = xr::Duration{cpuNs};
+  sample.shouldRender = shouldRender;
+  return sample;
+}
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(FrameDispatch)
+
+class OpenXrFrameTimingTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrFrameTimingTest, histogramTest) {
+  for (int64_t micros : {0, 1, 7, 8, 9, 15, 16, 100, 1234, 11111, 99999, 8000000}) {
+    const xr::Duration value{micros * 1000 + 500};
+    const uint32_t bucket = xr::FrameTimingHistogram::bucketOf(value);
+    EXPECT_LE(xr::FrameTimingHistogram::bucketLowerBound(bucket), value) << micros;
+    EXPECT_GT(xr::FrameTimingHistogram::bucketLowerBound(bucket + 1), value) << micros;
+  }
+  const uint32_t lastBucket = xr::FrameTimingHistogram::bucketCount - 1;
+  EXPECT_EQ(xr::FrameTimingHistogram::bucketOf(xr::Duration{-5}), 0u);
+  EXPECT_EQ(xr::FrameTimingHistogram::bucketOf(xr::Duration{60000000000}), lastBucket);
+
+  xr::FrameTimingHistogram histogram;
+  EXPECT_EQ(histogram.percentile(0.5).get(), 0);
+  for (int64_t millis = 1; millis <= 100; ++millis) {
+    const xr::Duration value{millis * 1000000};
+    ++histogram.buckets[xr::FrameTimingHistogram::bucketOf(value)];
+    ++histogram.count;
+    histogram.total += value.get();
+  }
+  EXPECT_EQ(histogram.mean().get(), 50500000);
+  // Within one bucket width (1/8) above the true value.
+  EXPECT_GE(histogram.percentile(0.5).get(), 50000000);
+  EXPECT_LE(histogram.percentile(0.5).get(), 50000000 * 9 / 8);
+  EXPECT_GE(histogram.percentile(0.99).get(), 99000000);
+  EXPECT_LE(histogram.percentile(0.99).get(), 99000000 * 9 / 8);
+}
+
+TEST_F(OpenXrFrameTimingTest, windowTest) {
+  xr::FrameTimingRecorder<4> recorder;
+  XrTime displayTime = kFirstDisplayTime;
+  for (int64_t i = 1; i <= 6; ++i) {
+    // The second frame is displayed a period late; the second and third say not to render.
+    displayTime += i == 2 ? 2 * kPeriod : kPeriod;
+    recorder.addSample(makeSample(displayTime, i * 1000000, 2000000, i != 2 && i != 3));
+  }
+  xr::FrameTimingSnapshot snapshot;
+  recorder.snapshot(snapshot);
+  EXPECT_EQ(snapshot.frameCount, 6u);
+  EXPECT_EQ(snapshot.windowFrameCount, 4u);
+  // Frames 1 and 2 have left the window.
+  EXPECT_EQ(snapshot.shouldRenderMissCount, 1u);
+  EXPECT_EQ(snapshot.lateFrameCount, 0u);
+  EXPECT_EQ(snapshot.waitTime.count, 4u);
+  EXPECT_EQ(snapshot.waitTime.mean().get(), 4500000);
+  EXPECT_EQ(snapshot.cpuTime.mean().get(), 2000000);
+  EXPECT_EQ(snapshot.jitter.count, 4u);
+  EXPECT_EQ(snapshot.jitter.percentile(1.0).get(), 1000);
+
+  xr::FrameTimingSample samples[8];
+  ASSERT_EQ(recorder.copySamples(samples, 8), 4u);
+  EXPECT_EQ(samples[0].waitTime.get(), 3000000);
+  EXPECT_EQ(samples[3].waitTime.get(), 6000000);
+  EXPECT_EQ(samples[3].displayTimeDelta.get(), kPeriod);
+  ASSERT_EQ(recorder.copySamples(samples, 2), 2u);
+  EXPECT_EQ(samples[1].waitTime.get(), 6000000);
+}
+
+TEST_F(OpenXrFrameTimingTest, frameLoopTest) {
+  FrameDispatch d;
+  xr::FrameTimingRecorder<> recorder;
+  for (int i = 0; i < 12; ++i) {
+    xr::FrameState frameState;
+    ASSERT_TRUE(recorder.waitFrame(xr::Session{}, xr::FrameWaitInfo{}, frameState, d) == xr::Result::Success);
+    ASSERT_TRUE(recorder.beginFrame(xr::Session{}, xr::FrameBeginInfo{}, d) == xr::Result::Success);
+    ASSERT_TRUE(recorder.endFrame(xr::Session{}, xr::FrameEndInfo{}, d) == xr::Result::Success);
+  }
+  EXPECT_EQ(d.ends, 12);
+  EXPECT_EQ(recorder.frameCount(), 12u);
+
+  xr::FrameTimingSnapshot snapshot;
+  recorder.snapshot(snapshot);
+  EXPECT_EQ(snapshot.windowFrameCount, 12u);
+  EXPECT_EQ(snapshot.shouldRenderMissCount, 3u);
+  EXPECT_EQ(snapshot.lateFrameCount, 4u);
+  EXPECT_EQ(snapshot.jitter.count, 11u);
+  EXPECT_EQ(snapshot.waitTime.count, 12u);
+
+  xr::FrameTimingSample samples[12];
+  ASSERT_EQ(recorder.copySamples(samples, 12), 12u);
+  EXPECT_EQ(samples[0].predictedDisplayTime.get(), kFirstDisplayTime + kPeriod);
+  EXPECT_EQ(samples[0].displayTimeDelta.get(), 0);
+  EXPECT_EQ(samples[2].displayTimeDelta.get(), 2 * kPeriod);
+  EXPECT_FALSE(samples[3].shouldRender);
+  EXPECT_TRUE(samples[4].shouldRender);
+  EXPECT_GE(samples[5].waitTime.get(), 0);
+  EXPECT_GE(samples[5].cpuTime.get(), 0);
+}
+
+TEST_F(OpenXrFrameTimingTest, failedEndFrameTest) {
+  FrameDispatch d;
+  xr::FrameTimingRecorder<> recorder;
+  xr::FrameState frameState;
+  recorder.waitFrame(xr::Session{}, xr::FrameWaitInfo{}, frameState, d);
+  recorder.beginFrame(xr::Session{}, xr::FrameBeginInfo{}, d);
+  d.endResult = XR_ERROR_SESSION_LOST;
+  EXPECT_TRUE(recorder.endFrame(xr::Session{}, xr::FrameEndInfo{}, d) == xr::Result::ErrorSessionLost);
+  EXPECT_EQ(recorder.frameCount(), 0u);
+
+  d.endResult = XR_SUCCESS;
+  recorder.waitFrame(xr::Session{}, xr::FrameWaitInfo{}, frameState, d);
+  recorder.beginFrame(xr::Session{}, xr::FrameBeginInfo{}, d);
+  recorder.endFrame(xr::Session{}, xr::FrameEndInfo{}, d);
+  EXPECT_EQ(recorder.frameCount(), 1u);
+}
+
+TEST_F(OpenXrFrameTimingTest, reusedWaitTest) {
+  FrameDispatch d;
+  xr::FrameTimingRecorder<> recorder;
+  // Begun before any wait.
+  recorder.beginFrame(xr::Session{}, xr::FrameBeginInfo{}, d);
+  recorder.endFrame(xr::Session{}, xr::FrameEndInfo{}, d);
+  EXPECT_EQ(recorder.frameCount(), 0u);
+
+  xr::FrameState frameState;
+  recorder.waitFrame(xr::Session{}, xr::FrameWaitInfo{}, frameState, d);
+  recorder.beginFrame(xr::Session{}, xr::FrameBeginInfo{}, d);
+  recorder.endFrame(xr::Session{}, xr::FrameEndInfo{}, d);
+  // Begun again on the same wait.
+  recorder.beginFrame(xr::Session{}, xr::FrameBeginInfo{}, d);
+  recorder.endFrame(xr::Session{}, xr::FrameEndInfo{}, d);
+  EXPECT_EQ(d.ends, 3);
+  EXPECT_EQ(recorder.frameCount(), 1u);
+
+  recorder.waitFrame(xr::Session{}, xr::FrameWaitInfo{}, frameState, d);
+  recorder.beginFrame(xr::Session{}, xr::FrameBeginInfo{}, d);
+  recorder.endFrame(xr::Session{}, xr::FrameEndInfo{}, d);
+  xr::FrameTimingSnapshot snapshot;
+  recorder.snapshot(snapshot);
+  EXPECT_EQ(snapshot.frameCount, 2u);
+  EXPECT_EQ(snapshot.waitTime.count, 2u);
+  EXPECT_EQ(snapshot.jitter.count, 1u);
+}
+
+TEST_F(OpenXrFrameTimingTest, concurrentSnapshotTest) {
+  xr::FrameTimingRecorder<64> recorder;
+  std::thread frameLoop([&] {
+    for (int64_t i = 1; i <= 20000; ++i) {
+      recorder.addSample(makeSample(kFirstDisplayTime + i * kPeriod, i, 2 * i, i % 2 == 0));
+    }
+  });
+  // Every snapshot is of a whole number of frames, however often the frame loop is interrupted.
+  for (int i = 0; i < 2000; ++i) {
+    xr::FrameTimingSnapshot snapshot;
+    recorder.snapshot(snapshot);
+    ASSERT_EQ(snapshot.waitTime.count, snapshot.windowFrameCount);
+    ASSERT_EQ(snapshot.cpuTime.total, 2 * snapshot.waitTime.total);
+    const uint32_t oddFrames = uint32_t(snapshot.frameCount / 2 + snapshot.frameCount % 2);
+    const uint32_t evictedOddFrames = uint32_t((snapshot.frameCount - snapshot.windowFrameCount + 1) / 2);
+    ASSERT_EQ(snapshot.shouldRenderMissCount, oddFrames - evictedOddFrames);
+  }
+  frameLoop.join();
+}
@@ -0,0 +1,88 @@
+#include "openxr/openxr_hand_joints.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+struct HandJointsDispatch {
+  XrResult result = XR_SUCCESS;
+  uint32_t calls = 0;
+
+  XrResult xrLocateHandJointsEXT(XrHandTrackerEXT tracker, const XrHandJointsLocateInfoEXT *,
+                                 XrHandJointLocationsEXT *locations) {
+    ++calls;
+    if (result != XR_SUCCESS) {
+      return result;
+    }
+    // Joint i of hand h sits at (i, h, 0); odd joints lack a valid position.
+    uint64_t hand = reinterpret_cast<uint64_t>(tracker);
+    locations->isActive = XR_TRUE;
+    for (uint32_t i = 0; i < locations->jointCount; ++i) {
+      XrHandJointLocationEXT &joint = locations->jointLocations[i];
+      joint.locationFlags = XR_SPACE_LOCATION_ORIENTATION_VALID_BIT | XR_SPACE_LOCATION_ORIENTATION_TRACKED_BIT;
+      if (i % 2 == 0) {
+        joint.locationFlags |= XR_SPACE_LOCATION_POSITION_VALID_BIT | XR_SPACE_LOCATION_POSITION_TRACKED_BIT;
+      }
+      joint.pose = XrPosef{{0.f, 0.f, 0.f, 1.f}, {float(i), float(hand), 0.f}};
+      joint.radius = 0.01f;
+    }
+    return XR_SUCCESS;
+  }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(HandJointsDispatch)
+
+class OpenXrHandJointsTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrHandJointsTest, locateTest) {
+  HandJointsDispatch d;
+  xr::HandJointsSoA<> left;
+  xr::HandJointsSoA<> right;
+  xr::HandTrackerEXT leftTracker{reinterpret_cast<XrHandTrackerEXT>(uint64_t(1))};
+  xr::HandTrackerEXT rightTracker{reinterpret_cast<XrHandTrackerEXT>(uint64_t(2))};
+  EXPECT_TRUE(xr::locateHandJoints(leftTracker, rightTracker, xr::Space{}, xr::Time{1}, left, right, d) ==
+              xr::Result::Success);
+  EXPECT_EQ(d.calls, 2u);
+  EXPECT_TRUE(left.isActive);
+  EXPECT_EQ(left.validMask, 0x1555555u);
+  EXPECT_EQ(left.trackedMask, 0x1555555u);
+  EXPECT_EQ(left.positionX[4], 4.f);
+  EXPECT_EQ(left.positionY[4], 1.f);
+  EXPECT_EQ(right.positionY[4], 2.f);
+  EXPECT_EQ(left.radius[25], 0.01f);
+
+  d.result = XR_ERROR_HANDLE_INVALID;
+  EXPECT_TRUE(xr::locateHandJoints(leftTracker, xr::Space{}, xr::Time{1}, left, d) == xr::Result::ErrorHandleInvalid);
+  EXPECT_FALSE(left.isActive);
+  EXPECT_EQ(left.validMask, 0u);
+}
+
+TEST_F(OpenXrHandJointsTest, kernelTest) {
+  HandJointsDispatch d;
+  xr::HandJointsSoA<> left;
+  xr::HandJointsSoA<> right;
+  xr::HandTrackerEXT leftTracker{reinterpret_cast<XrHandTrackerEXT>(uint64_t(1))};
+  xr::HandTrackerEXT rightTracker{reinterpret_cast<XrHandTrackerEXT>(uint64_t(2))};
+  xr::locateHandJoints(leftTracker, rightTracker, xr::Space{}, xr::Time{1}, left, right, d);
+
+  float squared[XR_HAND_JOINT_COUNT_EXT];
+  xr::squaredJointDistances(left, xr::HandJointEXT::Palm, squared);
+  EXPECT_EQ(squared[0], 0.f);
+  EXPECT_EQ(squared[3], 9.f);
+  xr::squaredJointDistances(left, right, squared);
+  EXPECT_EQ(squared[7], 1.f);
+
+  // Joints 0..4 are within 2.5 of joint 2, but only the even ones are valid.
+  EXPECT_EQ(xr::jointsWithin(left, static_cast<xr::HandJointEXT>(2), 2.5f), 0x15u);
+  EXPECT_EQ(xr::jointsWithin(left, static_cast<xr::HandJointEXT>(3), 2.5f), 0u);
+
+  xr::transformHandJoints(xr::Posef{{}, {0.f, 0.f, 5.f}}, left);
+  EXPECT_EQ(left.position(static_cast<xr::HandJointEXT>(6)).z, 5.f);
+  EXPECT_EQ(left.position(static_cast<xr::HandJointEXT>(6)).x, 6.f);
+  EXPECT_EQ(left.pose(static_cast<xr::HandJointEXT>(25)).orientation.w, 1.f);
+}
@@ -0,0 +1,100 @@
+#include "openxr/openxr_hash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+template <typename T>
+size_t hashOf(T const &value) {
+  return std::hash<T>()(value);
+}
+} // namespace
+
+class OpenXrHashTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrHashTest, equalityTest) {
+  xr::ReferenceSpaceCreateInfo a{xr::ReferenceSpaceType::Stage, xr::Posef{}};
+  xr::ReferenceSpaceCreateInfo b = a;
+  EXPECT_TRUE(a == b);
+  EXPECT_FALSE(a != b);
+
+  // next is not compared.
+  xr::ActionSetCreateInfo chained;
+  b.next = &chained;
+  EXPECT_TRUE(a == b);
+
+  b.poseInReferenceSpace.position.y = 1.5f;
+  EXPECT_FALSE(a == b);
+  EXPECT_TRUE(a != b);
+  b.poseInReferenceSpace.position.y = 0;
+  b.referenceSpaceType = xr::ReferenceSpaceType::Local;
+  EXPECT_FALSE(a == b);
+
+  // Zeros of either sign are equal.
+  xr::Vector3f zero{0, 0, 0};
+  xr::Vector3f negativeZero{-0.f, 0, 0};
+  EXPECT_TRUE(zero == negativeZero);
+  EXPECT_EQ(hashOf(zero), hashOf(negativeZero));
+}
+
+TEST_F(OpenXrHashTest, stringTest) {
+  xr::ActionCreateInfo a{"grab", xr::ActionType::BooleanInput, 0, nullptr, "Grab"};
+  xr::ActionCreateInfo b{"grab", xr::ActionType::BooleanInput, 0, nullptr, "Grab"};
+  // Whatever follows the terminator does not matter.
+  a.actionName[sizeof(a.actionName) - 1] = 'x';
+  EXPECT_TRUE(a == b);
+  EXPECT_EQ(hashOf(a), hashOf(b));
+
+  strncpy(b.localizedActionName, "Grab!", sizeof(b.localizedActionName));
+  EXPECT_FALSE(a == b);
+  EXPECT_NE(hashOf(a), hashOf(b));
+}
+
+TEST_F(OpenXrHashTest, abstractTest) {
+  // The type of base structs is compared, since it tells which struct they are the header of.
+  xr::CompositionLayerProjection projection;
+  xr::CompositionLayerQuad quad;
+  const xr::CompositionLayerBaseHeader &projectionHeader = projection;
+  const xr::CompositionLayerBaseHeader &quadHeader = quad;
+  EXPECT_FALSE(projectionHeader == quadHeader);
+  EXPECT_TRUE(projectionHeader == projectionHeader);
+}
+
+TEST_F(OpenXrHashTest, cacheTest) {
+  std::unordered_map<xr::ReferenceSpaceCreateInfo, int> spaces;
+  for (int i = 0; i < 100; ++i) {
+    xr::ReferenceSpaceCreateInfo info{xr::ReferenceSpaceType::Local, xr::Posef{}};
+    info.poseInReferenceSpace.position.x = float(i % 10);
+    ++spaces[info];
+  }
+  ASSERT_EQ(spaces.size(), 10u);
+  for (auto const &entry : spaces) {
+    EXPECT_EQ(entry.second, 10);
+  }
+
+  std::unordered_set<xr::Path> paths{xr::Path{1}, xr::Path{2}, xr::Path{1}};
+  EXPECT_EQ(paths.size(), 2u);
+  std::unordered_set<xr::Space> spaceHandles{xr::Space{}, xr::Space{}};
+  EXPECT_EQ(spaceHandles.size(), 1u);
+  EXPECT_EQ(hashOf(xr::SpaceLocationFlags{xr::SpaceLocationFlagBits::PositionValid}),
+            hashOf(xr::SpaceLocationFlags{xr::SpaceLocationFlagBits::PositionValid}));
+}
+
+TEST_F(OpenXrHashTest, spreadTest) {
+  // Nearby poses land in distinct buckets.
+  std::unordered_set<size_t> hashes;
+  for (int i = 0; i < 1000; ++i) {
+    xr::Posef pose;
+    pose.position.z = float(i) * 0.001f;
+    hashes.insert(hashOf(pose) % 4096);
+  }
+  EXPECT_GT(hashes.size(), 850u);
+}
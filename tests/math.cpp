@@ -1,7 +1,11 @@
 #include "openxr/openxr.hpp"
+#include "openxr/openxr_math.hpp"
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 class OpenXrMathTest : public ::testing::Test {
 protected:
   void SetUp() override {}
@@ -21,3 +25,108 @@ TEST_F(OpenXrMathTest, vecTest) {
     EXPECT_EQ(xr::Vector3f().y, 0.f);
     EXPECT_EQ(xr::Vector3f().z, 0.f);
 }
+
+static void expectNear(xr::Vector3f const& a, xr::Vector3f const& b) {
+    EXPECT_NEAR(a.x, b.x, 1e-5f);
+    EXPECT_NEAR(a.y, b.y, 1e-5f);
+    EXPECT_NEAR(a.z, b.z, 1e-5f);
+}
+
+static void expectNear(xr::Quaternionf const& a, xr::Quaternionf const& b) {
+    EXPECT_NEAR(a.x, b.x, 1e-5f);
+    EXPECT_NEAR(a.y, b.y, 1e-5f);
+    EXPECT_NEAR(a.z, b.z, 1e-5f);
+    EXPECT_NEAR(a.w, b.w, 1e-5f);
+}
+
+static void expectNear(xr::Posef const& a, xr::Posef const& b) {
+    expectNear(a.orientation, b.orientation);
+    expectNear(a.position, b.position);
+}
+
+static xr::Posef makePose(int i) {
+    xr::Vector3f axis = xr::math::normalize(xr::Vector3f{1.f + i, 2.f - i, 0.5f * i});
+    return {xr::math::fromAxisAngle(axis, 0.3f * i), {0.1f * i, -0.2f * i, 1.f + i}};
+}
+
+TEST_F(OpenXrMathTest, poseTest) {
+    const float halfPi = 1.5707963f;
+    xr::Quaternionf yaw90 = xr::math::fromAxisAngle({0.f, 1.f, 0.f}, halfPi);
+    expectNear(xr::math::rotate(yaw90, {1.f, 0.f, 0.f}), {0.f, 0.f, -1.f});
+
+    xr::Posef pose{yaw90, {1.f, 2.f, 3.f}};
+    expectNear(xr::math::transform(pose, {1.f, 0.f, 0.f}), {1.f, 2.f, 2.f});
+    expectNear(xr::math::compose(pose, xr::math::inverse(pose)), xr::Posef{});
+    expectNear(xr::math::compose(xr::math::inverse(pose), pose), xr::Posef{});
+
+    xr::Posef other = makePose(3);
+    xr::Vector3f point{0.5f, -1.f, 2.f};
+    expectNear(xr::math::transform(xr::math::compose(pose, other), point),
+               xr::math::transform(pose, xr::math::transform(other, point)));
+
+    xr::math::Matrix4x4f m = xr::math::toMatrix(pose);
+    xr::Vector3f viaMatrix{m.m[0] * point.x + m.m[4] * point.y + m.m[8] * point.z + m.m[12],
+                           m.m[1] * point.x + m.m[5] * point.y + m.m[9] * point.z + m.m[13],
+                           m.m[2] * point.x + m.m[6] * point.y + m.m[10] * point.z + m.m[14]};
+    expectNear(viaMatrix, xr::math::transform(pose, point));
+
+    static_assert(xr::math::transform(xr::Posef{}, {1.f, 2.f, 3.f}).y == 2.f, "pose math should be constexpr");
+}
+
+TEST_F(OpenXrMathTest, slerpTest) {
+    xr::Quaternionf a = xr::math::fromAxisAngle({0.f, 0.f, 1.f}, 0.2f);
+    xr::Quaternionf b = xr::math::fromAxisAngle({0.f, 0.f, 1.f}, 1.0f);
+    expectNear(xr::math::slerp(a, b, 0.f), a);
+    expectNear(xr::math::slerp(a, b, 1.f), b);
+    expectNear(xr::math::slerp(a, b, 0.5f), xr::math::fromAxisAngle({0.f, 0.f, 1.f}, 0.6f));
+    // Takes the shortest arc even if the inputs are in opposite hemispheres.
+    xr::Quaternionf negB{-b.x, -b.y, -b.z, -b.w};
+    expectNear(xr::math::slerp(a, negB, 0.5f), xr::math::fromAxisAngle({0.f, 0.f, 1.f}, 0.6f));
+    expectNear(xr::math::slerp(a, a, 0.5f), a);
+}
+
+TEST_F(OpenXrMathTest, batchTest) {
+    // Not a multiple of the SIMD width, so the scalar tail is exercised too.
+    const size_t count = 11;
+    std::vector<xr::Posef> poses;
+    std::vector<xr::Vector3f> points;
+    for (size_t i = 0; i < count; ++i) {
+        poses.push_back(makePose(int(i)));
+        points.push_back({0.3f * i, 1.f - i, 2.f});
+    }
+    xr::Posef base = makePose(7);
+
+    std::vector<float> v(3 * count);
+    xr::math::Vector3fSoA pointsSoA{&v[0], &v[count], &v[2 * count]};
+    xr::math::toSoA(points.data(), count, pointsSoA);
+    xr::math::transformPoints(base, pointsSoA, pointsSoA, count);
+    std::vector<xr::Vector3f> transformed(count);
+    xr::math::fromSoA(pointsSoA, count, transformed.data());
+    for (size_t i = 0; i < count; ++i) {
+        expectNear(transformed[i], xr::math::transform(base, points[i]));
+    }
+
+    xr::math::toSoA(points.data(), count, pointsSoA);
+    xr::math::rotateVectors(base.orientation, pointsSoA, pointsSoA, count);
+    xr::math::fromSoA(pointsSoA, count, transformed.data());
+    for (size_t i = 0; i < count; ++i) {
+        expectNear(transformed[i], xr::math::rotate(base.orientation, points[i]));
+    }
+
+    std::vector<float> p(7 * count);
+    xr::math::PosefSoA posesSoA{{&p[0], &p[count], &p[2 * count], &p[3 * count]}, {&p[4 * count], &p[5 * count], &p[6 * count]}};
+    xr::math::toSoA(poses.data(), count, posesSoA);
+    xr::math::composePoses(base, posesSoA, posesSoA, count);
+    std::vector<xr::Posef> composed(count);
+    xr::math::fromSoA(posesSoA, count, composed.data());
+    for (size_t i = 0; i < count; ++i) {
+        expectNear(composed[i], xr::math::compose(base, poses[i]));
+    }
+
+    xr::math::toSoA(poses.data(), count, posesSoA);
+    xr::math::inversePoses(posesSoA, posesSoA, count);
+    xr::math::fromSoA(posesSoA, count, composed.data());
+    for (size_t i = 0; i < count; ++i) {
+        expectNear(composed[i], xr::math::inverse(poses[i]));
+    }
+}
@@ -0,0 +1,142 @@
+#include "openxr/openxr_path_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+struct PathDispatch {
+  std::mutex mutex;
+  std::map<std::string, XrPath> paths;
+  std::vector<std::string> strings;
+  std::atomic<uint32_t> stringToPathCalls{0};
+  std::atomic<uint32_t> pathToStringCalls{0};
+
+  XrResult xrStringToPath(XrInstance, const char *pathString, XrPath *path) {
+    ++stringToPathCalls;
+    if (pathString[0] != '/') {
+      return XR_ERROR_PATH_FORMAT_INVALID;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = paths.find(pathString);
+    if (it == paths.end()) {
+      strings.push_back(pathString);
+      it = paths.emplace(pathString, strings.size()).first;
+    }
+    *path = it->second;
+    return XR_SUCCESS;
+  }
+
+  XrResult xrPathToString(XrInstance, XrPath path, uint32_t capacity, uint32_t *count, char *buffer) {
+    ++pathToStringCalls;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (path == XR_NULL_PATH || path > strings.size()) {
+      return XR_ERROR_PATH_INVALID;
+    }
+    std::string const &str = strings[path - 1];
+    *count = uint32_t(str.size() + 1);
+    if (capacity < *count) {
+      return XR_ERROR_SIZE_INSUFFICIENT;
+    }
+    memcpy(buffer, str.c_str(), str.size() + 1);
+    return XR_SUCCESS;
+  }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(PathDispatch)
+
+class OpenXrPathCacheTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrPathCacheTest, roundTripTest) {
+  PathDispatch d;
+  xr::PathCache<> cache{xr::Instance{}};
+  const char *strings[] = {"/user/hand/left", "/user/hand/right"};
+  EXPECT_TRUE(cache.prepopulate(strings, 2, d) == xr::Result::Success);
+  EXPECT_EQ(cache.size(), 2u);
+
+  xr::Path left;
+  EXPECT_TRUE(cache.stringToPath(std::string("/user/hand/left"), left, d) == xr::Result::Success);
+  EXPECT_TRUE(cache.stringToPath("/user/hand/leftover", 15, left, d) == xr::Result::Success);
+  EXPECT_EQ(d.stringToPathCalls.load(), 2u);
+  EXPECT_EQ(left.get(), 1u);
+
+  // Strings interned by stringToPath answer pathToString too.
+  const char *str = nullptr;
+  EXPECT_TRUE(cache.pathToString(xr::Path{2}, str, d) == xr::Result::Success);
+  EXPECT_STREQ(str, "/user/hand/right");
+  EXPECT_EQ(d.pathToStringCalls.load(), 0u);
+
+  // A path first seen from the runtime is cached in both directions.
+  xr::Path head;
+  d.xrStringToPath(XR_NULL_HANDLE, "/user/head", head.put());
+  EXPECT_TRUE(cache.pathToString(head, str, d) == xr::Result::Success);
+  EXPECT_STREQ(str, "/user/head");
+  const char *again = nullptr;
+  cache.pathToString(head, again, d);
+  EXPECT_EQ(again, str);
+  EXPECT_EQ(d.pathToStringCalls.load(), 1u);
+  xr::Path headAgain;
+  uint32_t callsBefore = d.stringToPathCalls.load();
+  cache.stringToPath("/user/head", headAgain, d);
+  EXPECT_EQ(d.stringToPathCalls.load(), callsBefore);
+  EXPECT_TRUE(headAgain == head);
+
+  // Failures are returned and not cached.
+  xr::Path bad;
+  EXPECT_TRUE(cache.stringToPath("bad", bad, d) == xr::Result::ErrorPathFormatInvalid);
+  EXPECT_TRUE(cache.pathToString(xr::Path{99}, str, d) == xr::Result::ErrorPathInvalid);
+  EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST_F(OpenXrPathCacheTest, fullTest) {
+  PathDispatch d;
+  xr::PathCache<4> cache{xr::Instance{}};
+  xr::Path path;
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(cache.stringToPath("/p/" + std::to_string(i), path, d) == xr::Result::Success);
+  }
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_EQ(path.get(), 5u);
+  const char *str = nullptr;
+  EXPECT_TRUE(cache.pathToString(xr::Path{1}, str, d) == xr::Result::Success);
+  EXPECT_TRUE(cache.pathToString(xr::Path{5}, str, d) == xr::Result::ErrorLimitReached);
+}
+
+TEST_F(OpenXrPathCacheTest, threadedTest) {
+  PathDispatch d;
+  xr::PathCache<> cache{xr::Instance{}};
+  std::atomic<bool> mismatch{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int round = 0; round < 50; ++round) {
+        for (int i = 0; i < 100; ++i) {
+          std::string name = "/user/path/" + std::to_string(i);
+          xr::Path path;
+          const char *str = nullptr;
+          if (!xr::succeeded(cache.stringToPath(name, path, d)) || !xr::succeeded(cache.pathToString(path, str, d)) ||
+              name != str) {
+            mismatch = true;
+          }
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_FALSE(mismatch.load());
+  EXPECT_EQ(d.stringToPathCalls.load(), 100u);
+  EXPECT_EQ(d.pathToStringCalls.load(), 0u);
+}
@@ -0,0 +1,187 @@
+#include "openxr/openxr_serialize.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+template <typename T>
+std::vector<unsigned char> serialized(T const &value) {
+  std::vector<unsigned char> bytes(xr::serialize(nullptr, 0, value));
+  EXPECT_EQ(xr::serialize(bytes.data(), bytes.size(), value), bytes.size());
+  return bytes;
+}
+
+template <typename T>
+bool deserialized(std::vector<unsigned char> const &bytes, T &value) {
+  size_t consumed = 0;
+  const bool result = xr::deserialize(bytes.data(), bytes.size(), value, &consumed);
+  EXPECT_TRUE(!result || consumed == bytes.size());
+  return result;
+}
+} // namespace
+
+class OpenXrSerializeTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrSerializeTest, scalarTest) {
+  const std::vector<unsigned char> bytes = serialized(uint32_t(0x01020304));
+  EXPECT_EQ(bytes, (std::vector<unsigned char>{4, 3, 2, 1}));
+  EXPECT_EQ(serialized(xr::Time{-1}), std::vector<unsigned char>(8, 0xff));
+  EXPECT_EQ(serialized(xr::SpaceLocationFlagBits::PositionValid).size(), 8u);
+
+  xr::Version version;
+  ASSERT_TRUE(deserialized(serialized(xr::Version{1, 0, 34}), version));
+  EXPECT_TRUE(version == xr::Version(1, 0, 34));
+  xr::Path path;
+  ASSERT_TRUE(deserialized(serialized(xr::Path{0x2a}), path));
+  EXPECT_EQ(path.get(), 0x2au);
+}
+
+TEST_F(OpenXrSerializeTest, structTest) {
+  // Plain structs are written as their members, without padding.
+  xr::Posef pose;
+  pose.position = xr::Vector3f{1.5f, 0, -2};
+  EXPECT_EQ(serialized(pose).size(), 7 * sizeof(float));
+  xr::Posef posed{xr::Quaternionf{1, 1, 1, 1}, xr::Vector3f{}};
+  ASSERT_TRUE(deserialized(serialized(pose), posed));
+  EXPECT_EQ(posed.position.x, 1.5f);
+  EXPECT_EQ(posed.orientation.w, 1.f);
+
+  // type and next are left as they are, and take up no space.
+  xr::SpaceLocation location;
+  location.locationFlags = xr::SpaceLocationFlagBits::OrientationValid;
+  location.pose = pose;
+  const std::vector<unsigned char> bytes = serialized(location);
+  EXPECT_EQ(bytes.size(), 8 + 7 * sizeof(float) + 1);
+  xr::SpaceLocation read;
+  ASSERT_TRUE(deserialized(bytes, read));
+  EXPECT_TRUE(read.type == xr::StructureType::SpaceLocation);
+  EXPECT_TRUE(read.locationFlags == xr::SpaceLocationFlagBits::OrientationValid);
+  EXPECT_EQ(read.pose.position.z, -2.f);
+
+  xr::FrameState state;
+  state.predictedDisplayTime = xr::Time{1000};
+  state.shouldRender = true;
+  xr::FrameState stateRead;
+  ASSERT_TRUE(deserialized(serialized(state), stateRead));
+  EXPECT_EQ(stateRead.predictedDisplayTime.get(), 1000);
+  EXPECT_TRUE(stateRead.shouldRender == XR_TRUE);
+
+  // Arrays of plain structs are copied whole, and come back the same.
+  xr::HandJointLocationEXT joints[XR_HAND_JOINT_COUNT_EXT];
+  for (uint32_t i = 0; i < XR_HAND_JOINT_COUNT_EXT; ++i) {
+    joints[i].radius = 0.01f * float(i);
+    joints[i].pose.position.y = float(i);
+  }
+  EXPECT_EQ(serialized(joints).size(), sizeof(joints));
+  xr::HandJointLocationEXT jointsRead[XR_HAND_JOINT_COUNT_EXT];
+  ASSERT_TRUE(deserialized(serialized(joints), jointsRead));
+  EXPECT_EQ(jointsRead[25].pose.position.y, 25.f);
+  EXPECT_EQ(jointsRead[3].radius, 0.03f);
+}
+
+TEST_F(OpenXrSerializeTest, stringTest) {
+  xr::ActionCreateInfo info{"grab", xr::ActionType::BooleanInput, 0, nullptr, "Grab"};
+  // Only the characters before the terminator are written.
+  EXPECT_EQ(serialized(info).size(), (1 + 4) + 4 + 4 + (1 + 4) + 1);
+
+  xr::ActionCreateInfo read;
+  read.actionName[5] = 'x';
+  ASSERT_TRUE(deserialized(serialized(info), read));
+  EXPECT_STREQ(read.actionName, "grab");
+  EXPECT_EQ(read.actionName[5], '\0');
+  EXPECT_STREQ(read.localizedActionName, "Grab");
+  EXPECT_TRUE(read.actionType == xr::ActionType::BooleanInput);
+
+  // A string too long for its array is rejected.
+  std::vector<unsigned char> bytes = serialized(info);
+  bytes[0] = XR_MAX_ACTION_NAME_SIZE;
+  EXPECT_FALSE(deserialized(bytes, read));
+}
+
+TEST_F(OpenXrSerializeTest, chainTest) {
+  xr::SpaceVelocity velocity;
+  velocity.velocityFlags = xr::SpaceVelocityFlagBits::LinearValid;
+  velocity.linearVelocity = xr::Vector3f{0, 9.8f, 0};
+  xr::SpaceLocation location;
+  location.locationFlags = xr::SpaceLocationFlagBits::PositionValid;
+  location.next = &velocity;
+  const std::vector<unsigned char> bytes = serialized(location);
+
+  // Chained structs are read into those of the same type in the destination chain.
+  xr::SpaceVelocity velocityRead;
+  xr::SpaceLocation read;
+  read.next = &velocityRead;
+  ASSERT_TRUE(deserialized(bytes, read));
+  EXPECT_TRUE(read.next == &velocityRead);
+  EXPECT_TRUE(velocityRead.velocityFlags == xr::SpaceVelocityFlagBits::LinearValid);
+  EXPECT_EQ(velocityRead.linearVelocity.y, 9.8f);
+
+  // And skipped if there is none.
+  xr::SpaceLocation unchained;
+  ASSERT_TRUE(deserialized(bytes, unchained));
+  EXPECT_TRUE(unchained.locationFlags == xr::SpaceLocationFlagBits::PositionValid);
+
+  // Structs of types not known here are left out, even when their tag would not have fit.
+  XrBaseOutStructure unknown{static_cast<XrStructureType>(1000999999), nullptr};
+  location.next = &unknown;
+  const size_t size = xr::serialize(nullptr, 0, location);
+  EXPECT_EQ(size, 8 + 7 * sizeof(float) + 1);
+  std::vector<unsigned char> exact(size, 0xaa);
+  EXPECT_EQ(xr::serialize(exact.data(), exact.size(), location), size);
+  EXPECT_EQ(exact.back(), 0);
+  xr::SpaceLocation unknownRead;
+  EXPECT_TRUE(deserialized(exact, unknownRead));
+  EXPECT_TRUE(unknownRead.locationFlags == xr::SpaceLocationFlagBits::PositionValid);
+}
+
+TEST_F(OpenXrSerializeTest, polymorphicTest) {
+  xr::CompositionLayerQuad quad;
+  quad.eyeVisibility = xr::EyeVisibility::Left;
+  quad.size = xr::Extent2Df{2, 1};
+  const std::vector<unsigned char> bytes = serialized(static_cast<xr::CompositionLayerBaseHeader const &>(quad));
+
+  xr::CompositionLayerQuad quadRead;
+  ASSERT_TRUE(deserialized(bytes, static_cast<xr::CompositionLayerBaseHeader &>(quadRead)));
+  EXPECT_TRUE(quadRead.eyeVisibility == xr::EyeVisibility::Left);
+  EXPECT_EQ(quadRead.size.width, 2.f);
+  // A different layer does not take it.
+  xr::CompositionLayerProjection projection;
+  EXPECT_FALSE(deserialized(bytes, static_cast<xr::CompositionLayerBaseHeader &>(projection)));
+
+  // Events in a buffer are written as the event they hold.
+  xr::EventDataSessionStateChanged changed;
+  changed.state = xr::SessionState::Focused;
+  changed.time = xr::Time{42};
+  xr::EventDataBuffer buffer;
+  memcpy(buffer.get(), changed.get(), sizeof(changed));
+  const std::vector<unsigned char> event = serialized(buffer);
+  xr::EventDataBuffer bufferRead;
+  ASSERT_TRUE(deserialized(event, bufferRead));
+  EXPECT_TRUE(bufferRead.type == xr::StructureType::EventDataSessionStateChanged);
+  const auto &changedRead = reinterpret_cast<xr::EventDataSessionStateChanged const &>(bufferRead);
+  EXPECT_TRUE(changedRead.state == xr::SessionState::Focused);
+  EXPECT_EQ(changedRead.time.get(), 42);
+}
+
+TEST_F(OpenXrSerializeTest, truncationTest) {
+  xr::ActionCreateInfo info{"grab", xr::ActionType::BooleanInput, 0, nullptr, "Grab"};
+  const std::vector<unsigned char> bytes = serialized(info);
+
+  // A buffer too small is left with what fits, and the size needed is returned.
+  std::vector<unsigned char> partial(4, 0xcc);
+  partial.push_back(0xee);
+  EXPECT_EQ(xr::serialize(partial.data(), 4, info), bytes.size());
+  EXPECT_EQ(partial[4], 0xee);
+
+  for (size_t size = 0; size < bytes.size(); ++size) {
+    xr::ActionCreateInfo read;
+    EXPECT_FALSE(xr::deserialize(bytes.data(), size, read)) << size;
+  }
+}
@@ -0,0 +1,145 @@
+#include "openxr/openxr_space_locator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+struct LocateSpaceDispatch {
+  std::atomic<uint32_t> calls{0};
+  // If set, locating space 1 at a multiple of this time stalls, so that other callers move on to later frames.
+  int64_t stallEvery = 0;
+
+  XrResult xrLocateSpace(XrSpace space, XrSpace baseSpace, XrTime time, XrSpaceLocation *location) {
+    ++calls;
+    if (stallEvery != 0 && time % stallEvery == 0 && reinterpret_cast<uintptr_t>(space) == 1) {
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    if (space == XR_NULL_HANDLE) {
+      return XR_ERROR_HANDLE_INVALID;
+    }
+    // Encode the inputs in the result so cache mix-ups are visible.
+    location->locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+    location->pose = XrPosef{{0.f, 0.f, 0.f, 1.f},
+                             {float(reinterpret_cast<uintptr_t>(space)), float(reinterpret_cast<uintptr_t>(baseSpace)),
+                              float(time)}};
+    return XR_SUCCESS;
+  }
+};
+
+xr::Space makeSpace(uintptr_t value) { return xr::Space{reinterpret_cast<XrSpace>(value)}; }
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(LocateSpaceDispatch)
+
+class OpenXrSpaceLocatorTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrSpaceLocatorTest, cacheTest) {
+  LocateSpaceDispatch d;
+  xr::SpaceLocator<> locator;
+  xr::SpaceLocation location;
+
+  EXPECT_TRUE(locator.locate(makeSpace(1), makeSpace(2), xr::Time{10}, location, d) == xr::Result::Success);
+  EXPECT_TRUE(locator.locate(makeSpace(1), makeSpace(2), xr::Time{10}, location, d) == xr::Result::Success);
+  EXPECT_EQ(d.calls.load(), 1u);
+  EXPECT_EQ(location.pose.position.x, 1.f);
+  EXPECT_EQ(location.pose.position.y, 2.f);
+  EXPECT_EQ(location.pose.position.z, 10.f);
+
+  // A different base space is a different key.
+  locator.locate(makeSpace(1), makeSpace(3), xr::Time{10}, location, d);
+  EXPECT_EQ(d.calls.load(), 2u);
+  EXPECT_EQ(location.pose.position.y, 3.f);
+
+  // A new time starts a new frame; an older time bypasses the cache.
+  locator.locate(makeSpace(1), makeSpace(2), xr::Time{20}, location, d);
+  locator.locate(makeSpace(1), makeSpace(2), xr::Time{20}, location, d);
+  EXPECT_EQ(d.calls.load(), 3u);
+  EXPECT_EQ(location.pose.position.z, 20.f);
+  locator.locate(makeSpace(1), makeSpace(2), xr::Time{10}, location, d);
+  EXPECT_EQ(location.pose.position.z, 10.f);
+  EXPECT_EQ(d.calls.load(), 4u);
+
+  // Failures are returned and not cached.
+  EXPECT_TRUE(locator.locate(xr::Space{}, makeSpace(2), xr::Time{20}, location, d) == xr::Result::ErrorHandleInvalid);
+
+  xr::SpaceLocator<>::Stats stats = locator.stats();
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.misses, 3u);
+  EXPECT_EQ(stats.bypasses, 2u);
+
+  locator.clear();
+  locator.locate(makeSpace(1), makeSpace(2), xr::Time{20}, location, d);
+  EXPECT_EQ(d.calls.load(), 6u);
+}
+
+TEST_F(OpenXrSpaceLocatorTest, failedLocateReleasesSlotTest) {
+  LocateSpaceDispatch d;
+  // A single slot, so that every key lands in the one the failed locate claimed.
+  xr::SpaceLocator<1> locator;
+  xr::SpaceLocation location;
+  EXPECT_TRUE(locator.locate(xr::Space{}, makeSpace(2), xr::Time{10}, location, d) == xr::Result::ErrorHandleInvalid);
+  locator.locate(makeSpace(1), makeSpace(2), xr::Time{10}, location, d);
+  locator.locate(makeSpace(1), makeSpace(2), xr::Time{10}, location, d);
+  EXPECT_EQ(d.calls.load(), 2u);
+  xr::SpaceLocator<1>::Stats stats = locator.stats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.bypasses, 1u);
+}
+
+TEST_F(OpenXrSpaceLocatorTest, locateAllTest) {
+  LocateSpaceDispatch d;
+  xr::SpaceLocator<8> locator;
+  std::vector<xr::SpaceLocator<8>::Query> queries;
+  for (uintptr_t i = 1; i <= 12; ++i) {
+    queries.push_back({makeSpace(i), makeSpace(100)});
+  }
+  std::vector<xr::SpaceLocation> locations(queries.size());
+  EXPECT_TRUE(locator.locateAll(xr::Time{5}, queries.data(), locations.data(), queries.size(), d) == xr::Result::Success);
+  for (size_t i = 0; i < queries.size(); ++i) {
+    EXPECT_EQ(locations[i].pose.position.x, float(i + 1));
+  }
+  // Only 8 fit in the table; the rest pass through.
+  EXPECT_EQ(locator.stats().misses, 8u);
+  EXPECT_EQ(locator.stats().bypasses, 4u);
+  locator.locateAll(xr::Time{5}, queries.data(), locations.data(), queries.size(), d);
+  EXPECT_EQ(locator.stats().hits, 8u);
+}
+
+TEST_F(OpenXrSpaceLocatorTest, threadedTest) {
+  LocateSpaceDispatch d;
+  d.stallEvery = 7;
+  xr::SpaceLocator<> locator;
+  std::atomic<bool> mismatch{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      xr::SpaceLocation location;
+      for (int64_t frame = 1; frame <= 200; ++frame) {
+        for (uintptr_t s = 1; s <= 8; ++s) {
+          locator.locate(makeSpace(s), makeSpace(50), xr::Time{frame}, location, d);
+          if (location.pose.position.x != float(s) || location.pose.position.y != 50.f ||
+              location.pose.position.z != float(frame)) {
+            mismatch = true;
+          }
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_FALSE(mismatch.load());
+  xr::SpaceLocator<>::Stats stats = locator.stats();
+  EXPECT_EQ(stats.hits + stats.misses + stats.bypasses, 4u * 200u * 8u);
+  EXPECT_GT(stats.hits, 0u);
+}
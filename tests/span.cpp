@@ -0,0 +1,67 @@
+#include "openxr/openxr_span.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+class OpenXrSpanTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+static_assert(std::is_same<decltype(xr::as_raw_span(
+                               std::declval<std::vector<xr::View> &>())),
+                           xr::Span<XrView>>::value,
+              "vector of projections should view as raw span");
+static_assert(std::is_same<decltype(xr::as_raw_span(
+                               std::declval<std::vector<xr::View> const &>())),
+                           xr::Span<XrView const>>::value,
+              "const vector should view as const raw span");
+
+TEST_F(OpenXrSpanTest, structTest) {
+  std::vector<xr::View> views(2);
+  views[1].pose.position.x = 2.f;
+
+  xr::Span<XrView> raw = xr::as_raw_span(views);
+  ASSERT_EQ(raw.size(), 2u);
+  EXPECT_EQ(static_cast<void *>(raw.data()), static_cast<void *>(views.data()));
+  EXPECT_EQ(raw[0].type, XR_TYPE_VIEW);
+  EXPECT_EQ(raw[1].pose.position.x, 2.f);
+  EXPECT_EQ(raw.size_bytes(), 2 * sizeof(XrView));
+
+  raw[0].fov.angleUp = 1.f;
+  EXPECT_EQ(views[0].fov.angleUp, 1.f);
+
+  xr::Span<xr::View> projected = xr::as_projected_span<xr::View>(raw.data(), raw.size());
+  EXPECT_EQ(projected.data(), views.data());
+
+  xr::Span<xr::View const> constProjected = projected;
+  float sum = 0;
+  for (xr::View const &view : constProjected) {
+    sum += view.pose.position.x;
+  }
+  EXPECT_EQ(sum, 2.f);
+}
+
+TEST_F(OpenXrSpanTest, atomAndHandleTest) {
+  XrPath rawPaths[3] = {1, 2, 3};
+  xr::Span<xr::Path> paths = xr::as_projected_span<xr::Path>(rawPaths);
+  ASSERT_EQ(paths.size(), 3u);
+  EXPECT_EQ(paths[2].get(), 3u);
+
+  std::array<xr::Space, 2> spaces;
+  xr::Span<XrSpace> rawSpaces = xr::as_raw_span(spaces);
+  EXPECT_EQ(rawSpaces.size(), 2u);
+  EXPECT_EQ(rawSpaces[1], XR_NULL_HANDLE);
+
+  std::vector<XrTime> times{10, 20};
+  xr::Span<xr::Time const> projectedTimes =
+      xr::as_projected_span<xr::Time>(static_cast<std::vector<XrTime> const &>(times));
+  EXPECT_EQ(projectedTimes[1].get(), 20);
+
+  xr::Span<XrTime> empty = xr::as_raw_span(static_cast<xr::Time *>(nullptr), 0);
+  EXPECT_TRUE(empty.empty());
+}
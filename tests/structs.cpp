@@ -0,0 +1,58 @@
+#include "openxr/openxr.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <type_traits>
+
+class OpenXrStructsTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+static_assert(std::is_trivially_copyable<xr::CompositionLayerProjectionView>::value,
+              "typed structs should be trivially copyable");
+static_assert(std::is_trivially_copyable<xr::Posef>::value,
+              "untyped structs should be trivially copyable");
+static_assert(std::is_trivially_copyable<xr::ApplicationInfo>::value,
+              "structs with fixed-size strings should be trivially copyable");
+
+static constexpr xr::Posef identityPose{};
+static_assert(identityPose.orientation.w == 1.0f, "default pose should be identity");
+
+static constexpr xr::CompositionLayerProjectionView staticView{
+    xr::Posef{xr::Quaternionf{}, xr::Vector3f{0.f, 1.5f, 0.f}},
+    xr::Fovf{-1.f, 1.f, 1.f, -1.f},
+    xr::SwapchainSubImage{xr::Swapchain{}, xr::Rect2Di{{0, 0}, {1024, 1024}}, 0}};
+static_assert(staticView.type == xr::StructureType::CompositionLayerProjectionView,
+              "constexpr construction should set the structure type");
+static_assert(staticView.subImage.imageRect.extent.width == 1024,
+              "constexpr construction should set members");
+
+TEST_F(OpenXrStructsTest, fromRawTest) {
+  XrView raw{XR_TYPE_VIEW, nullptr, {{0.f, 0.f, 0.f, 1.f}, {1.f, 2.f, 3.f}},
+             {-1.f, 1.f, 1.f, -1.f}};
+  xr::View view{raw};
+  EXPECT_EQ(view.type, xr::StructureType::View);
+  EXPECT_EQ(view.pose.position.y, 2.f);
+  EXPECT_EQ(view.fov.angleRight, 1.f);
+  EXPECT_EQ(std::memcmp(&raw, view.get(), sizeof(raw)), 0);
+
+  raw.pose.position.z = 5.f;
+  view = raw;
+  EXPECT_EQ(view.pose.position.z, 5.f);
+}
+
+TEST_F(OpenXrStructsTest, memcpyTest) {
+  xr::ApplicationInfo info{"app", 1, "engine", 2, xr::Version{1, 0, 0}};
+  xr::ApplicationInfo copy;
+  std::memcpy(&copy, &info, sizeof(info));
+  EXPECT_STREQ(copy.applicationName, "app");
+  EXPECT_STREQ(copy.engineName, "engine");
+  EXPECT_EQ(copy.engineVersion, 2u);
+
+  xr::ApplicationInfo empty;
+  EXPECT_STREQ(empty.applicationName, "");
+}
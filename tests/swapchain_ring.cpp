@@ -0,0 +1,147 @@
+#include "openxr/openxr_swapchain_ring.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+// Stands in for a graphics-API-specific image structure.
+struct TestImage {
+  XrStructureType type = XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO;
+  void *next = nullptr;
+  uint32_t image = 0;
+};
+
+// A runtime with a three-image swapchain that checks the acquire, wait, release order.
+struct SwapchainDispatch {
+  uint32_t nextIndex = 0;
+  bool acquired = false;
+  bool waited = false;
+  bool outOfOrder = false;
+  // Number of zero-timeout waits that time out before each image becomes ready.
+  int pendingPolls = 0;
+  int polls = 0;
+  int acquires = 0;
+  int releases = 0;
+
+  XrResult xrEnumerateSwapchainImages(XrSwapchain, uint32_t capacity, uint32_t *count, XrSwapchainImageBaseHeader *images) {
+    *count = 3;
+    if (capacity < 3) {
+      return XR_ERROR_SIZE_INSUFFICIENT;
+    }
+    TestImage *testImages = reinterpret_cast<TestImage *>(images);
+    for (uint32_t i = 0; i < 3; ++i) {
+      if (testImages[i].type != XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO) {
+        outOfOrder = true;
+      }
+      testImages[i].image = 100 + i;
+    }
+    return XR_SUCCESS;
+  }
+
+  XrResult xrAcquireSwapchainImage(XrSwapchain, const XrSwapchainImageAcquireInfo *, uint32_t *index) {
+    outOfOrder |= acquired;
+    acquired = true;
+    waited = false;
+    polls = 0;
+    ++acquires;
+    *index = nextIndex;
+    nextIndex = (nextIndex + 1) % 3;
+    return XR_SUCCESS;
+  }
+
+  XrResult xrWaitSwapchainImage(XrSwapchain, const XrSwapchainImageWaitInfo *waitInfo) {
+    outOfOrder |= !acquired || waited;
+    if (waitInfo->timeout == XR_NO_DURATION && polls++ < pendingPolls) {
+      return XR_TIMEOUT_EXPIRED;
+    }
+    waited = true;
+    return XR_SUCCESS;
+  }
+
+  XrResult xrReleaseSwapchainImage(XrSwapchain, const XrSwapchainImageReleaseInfo *) {
+    outOfOrder |= !waited;
+    acquired = false;
+    waited = false;
+    ++releases;
+    return XR_SUCCESS;
+  }
+};
+} // namespace
+
+OPENXR_HPP_CLASS_IS_DISPATCH(SwapchainDispatch)
+
+class OpenXrSwapchainRingTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(OpenXrSwapchainRingTest, cycleTest) {
+  SwapchainDispatch d;
+  xr::SwapchainRing<TestImage, 4> ring;
+  ring.setPrefetch(false);
+  ASSERT_TRUE(ring.init(xr::Swapchain{}, d) == xr::Result::Success);
+  EXPECT_EQ(ring.imageCount(), 3u);
+  EXPECT_EQ(ring.image(2).image, 102u);
+
+  for (uint32_t frame = 0; frame < 4; ++frame) {
+    ASSERT_TRUE(ring.acquireImage(xr::Duration::infinite(), d) == xr::Result::Success);
+    EXPECT_TRUE(ring.hasImage());
+    EXPECT_EQ(ring.currentIndex(), frame % 3);
+    EXPECT_EQ(ring.currentImage().image, 100 + frame % 3);
+    ASSERT_TRUE(ring.releaseImage(d) == xr::Result::Success);
+    EXPECT_FALSE(ring.hasImage());
+    // Without prefetching, nothing is acquired between frames.
+    EXPECT_FALSE(d.acquired);
+  }
+  EXPECT_FALSE(d.outOfOrder);
+  EXPECT_EQ(ring.stats().acquireCount, 4u);
+  EXPECT_EQ(ring.stats().prefetchHitCount, 0u);
+}
+
+TEST_F(OpenXrSwapchainRingTest, prefetchTest) {
+  SwapchainDispatch d;
+  xr::SwapchainRing<TestImage> ring;
+  ASSERT_TRUE(ring.init(xr::Swapchain{}, d) == xr::Result::Success);
+
+  ASSERT_TRUE(ring.acquireImage(xr::Duration::infinite(), d) == xr::Result::Success);
+  EXPECT_EQ(ring.currentIndex(), 0u);
+  ASSERT_TRUE(ring.releaseImage(d) == xr::Result::Success);
+  // The next image was acquired and waited for as part of the release.
+  EXPECT_TRUE(d.acquired);
+  EXPECT_TRUE(d.waited);
+  EXPECT_EQ(d.acquires, 2);
+
+  ASSERT_TRUE(ring.acquireImage(xr::Duration::infinite(), d) == xr::Result::Success);
+  EXPECT_EQ(ring.currentIndex(), 1u);
+  EXPECT_EQ(d.acquires, 2);
+  EXPECT_EQ(ring.stats().prefetchHitCount, 1u);
+  ASSERT_TRUE(ring.releaseImage(d) == xr::Result::Success);
+  EXPECT_FALSE(d.outOfOrder);
+  EXPECT_EQ(d.releases, 2);
+  EXPECT_EQ(ring.stats().acquireCount, 3u);
+
+  ring.resetStats();
+  EXPECT_EQ(ring.stats().acquireCount, 0u);
+}
+
+TEST_F(OpenXrSwapchainRingTest, notReadyTest) {
+  SwapchainDispatch d;
+  d.pendingPolls = 2;
+  xr::SwapchainRing<TestImage> ring;
+  ASSERT_TRUE(ring.init(xr::Swapchain{}, d) == xr::Result::Success);
+  ASSERT_TRUE(ring.acquireImage(xr::Duration::infinite(), d) == xr::Result::Success);
+  ASSERT_TRUE(ring.releaseImage(d) == xr::Result::Success);
+  // The prefetched image was acquired but is not ready yet.
+  EXPECT_TRUE(d.acquired);
+  EXPECT_FALSE(d.waited);
+
+  EXPECT_TRUE(ring.acquireImage(xr::Duration{XR_NO_DURATION}, d) == xr::Result::TimeoutExpired);
+  EXPECT_FALSE(ring.hasImage());
+  EXPECT_EQ(ring.currentIndex(), 1u);
+  ASSERT_TRUE(ring.acquireImage(xr::Duration::infinite(), d) == xr::Result::Success);
+  EXPECT_EQ(ring.currentIndex(), 1u);
+  EXPECT_EQ(ring.stats().prefetchHitCount, 0u);
+  EXPECT_EQ(d.acquires, 2);
+  EXPECT_FALSE(d.outOfOrder);
+}